@@ -14,7 +14,7 @@ private:
 
     // === Змінні внутрішнього PID ===
     float lastAngleError;  
-    float angleErrorSum;   
+    float integralTerm;    // Σ Ki·e·dt, кр/с — зміна Ki не стрибає виходом
     float targetAngle;    
 
     // === Зовнішній контур ===
@@ -24,6 +24,7 @@ private:
 
     // === Вихід ===
     float baseSpeed;    
+    float termP, termI, termD;   // складові останнього кроку (для логу)
 
     // === Параметри ===
     float balanceOffset;   
@@ -36,8 +37,7 @@ private:
     bool enabled;
 
     // === Зовнішній контур: targetSpeed -> targetAngle ===
-    void runOuterLoop() {
-        unsigned long now = millis();
+    void runOuterLoop(unsigned long now) {
         if (now - lastOuterMs < 100) return;  
         lastOuterMs = now;
         
@@ -48,8 +48,7 @@ private:
     }
 
     // === Внутрішній контур: currentAngle -> baseSpeed ===
-    void runInnerLoop(float currentAngle) {
-        unsigned long now = millis();
+    void runInnerLoop(float currentAngle, unsigned long now) {
         float dt = (now - lastInnerMs) / 1000.0f;
 
         lastInnerMs = now;
@@ -59,11 +58,11 @@ private:
 
         float P = Kp_inner * error;
 
-        angleErrorSum += error * dt;
+        integralTerm += Ki_inner * error * dt;
         
-        angleErrorSum = constrain(angleErrorSum, -500.0f, 500.0f);
+        integralTerm = constrain(integralTerm, -maxSpeed, maxSpeed);
 
-        float I = Ki_inner * angleErrorSum;
+        float I = integralTerm;
 
         float D = 0.0f;
         if (dt > 0.0f) {
@@ -72,6 +71,8 @@ private:
         lastAngleError = error;
 
 
+        termP = P; termI = I; termD = D;
+
         baseSpeed = constrain(P + I + D, -maxSpeed, maxSpeed);
     }
 
@@ -90,33 +91,38 @@ public:
     BalanceController()
         : Kp_inner(200.0f), Ki_inner(5.0f), Kd_inner(8.0f)
         , Kp_outer(5.0f)
-        , lastAngleError(0), angleErrorSum(0), targetAngle(0)
+        , lastAngleError(0), integralTerm(0), targetAngle(0)
         , targetSpeed(0), estimatedSpeed(0)
         , baseSpeed(0)
+        , termP(0), termI(0), termD(0)
         , balanceOffset(0), maxSpeed(15000.0f)
         , lastInnerMs(0), lastOuterMs(0)
         , enabled(false)
     {}
 
     // === Ініціалізація ===
-    void begin() {
-        lastInnerMs = millis();
-        lastOuterMs = millis();
+    void begin() { begin(millis()); }
+
+    void begin(unsigned long now) {
+        lastInnerMs = now;
+        lastOuterMs = now;
     }
 
 
-    void update(float currentAngle) {
+    void update(float currentAngle) { update(currentAngle, millis()); }
+
+    // Час задається ззовні — для відтворення записаних тактів
+    void update(float currentAngle, unsigned long now) {
         if (!enabled) { 
             baseSpeed = 0;
             estimatedSpeed = 0;
             return;
         }
 
-        unsigned long now = millis();
         float dt = (now - lastInnerMs) / 1000.0f;
 
-        runOuterLoop();
-        runInnerLoop(currentAngle);
+        runOuterLoop(now);
+        runInnerLoop(currentAngle, now);
         updateSpeedEstimate(dt);
     }
 
@@ -127,7 +133,7 @@ public:
     void setEnabled(bool en) {
         enabled = en;
         if (!en) {
-            angleErrorSum  = 0;
+            integralTerm   = 0;
             lastAngleError = 0;
             estimatedSpeed = 0;
             baseSpeed      = 0;
@@ -141,16 +147,31 @@ public:
 
     void setInnerPID(float Kp, float Ki, float Kd) {
         Kp_inner = Kp; Ki_inner = Ki; Kd_inner = Kd;
-        angleErrorSum = 0; 
+        integralTerm = 0; 
+    }
+    // Зміна на ходу: накопичена I-складова лишається, новий Ki діє
+    // лише на подальші помилки — без стрибка виходу
+    void setInnerGains(float Kp, float Ki, float Kd) {
+        Kp_inner = Kp; Ki_inner = Ki; Kd_inner = Kd;
     }
     void setOuterPID(float Kp)        { Kp_outer = Kp; }
-    void setBalanceOffset(float off)  { balanceOffset = off; }
+
+    // Помилка зсувається разом зі зміщенням — без сплеску D-складової
+    void setBalanceOffset(float off) {
+        lastAngleError += off - balanceOffset;
+        balanceOffset   = off;
+    }
     void setMaxSpeed(float spd)       { maxSpeed = spd; }
 
     // === Вихідні дані для RobotController ===
     float getBaseSpeed()     const { return baseSpeed; }
     float getTargetAngle()   const { return targetAngle; }
     float getEstimatedSpeed()const { return estimatedSpeed; }
+    float getTargetSpeed()   const { return targetSpeed; }
+    float getMaxSpeed()      const { return maxSpeed; }
+    float getTermP()         const { return termP; }
+    float getTermI()         const { return termI; }
+    float getTermD()         const { return termD; }
     bool  isEnabled()        const { return enabled; }
 
 };
\ No newline at end of file
@@ -0,0 +1,383 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+
+
+// =========================================================
+//  Бінарний лог стану контролера (.bblog)
+//  Не залежить від Arduino — той самий файл збирає tools/botlog.cpp
+//
+//  Файл:   [Header][Record][Record]...
+//  Header: "BBLG" | version u8 | fieldCount u8 | keyframeInterval u16
+//  Record v2: sync u8 | seq u8 | len u8 | payload[len] | crc8
+//    sync    SYNC_KEY (абсолютні значення) або SYNC_DELTA (різниця з попереднім)
+//    payload fieldCount × zigzag-varint
+//    crc8    по seq, len і payload
+//  Кожен KEYFRAME_INTERVAL-й запис — ключовий. Пропуск у seq або
+//  битий CRC — дельти відкидаються до наступного ключового запису.
+//  Значення — цілі з фіксованою точкою, масштаб у BLOG_FIELDS
+// =========================================================
+
+enum BinaryLog_Field : uint8_t {
+    BLOG_TIME_MS = 0,
+    BLOG_PITCH,             // 0.01°
+    BLOG_ROLL,              // 0.01°
+    BLOG_GYRO_Y,            // 0.01 °/с
+    BLOG_GYRO_Z,            // 0.01 °/с
+    BLOG_ACC_X,             // сирі одиниці MPU6050
+    BLOG_ACC_Y,
+    BLOG_ACC_Z,
+    BLOG_TARGET_ANGLE,      // 0.01°
+    BLOG_TARGET_SPEED,      // кр/с
+    BLOG_BASE_SPEED,        // кр/с
+    BLOG_EST_SPEED,         // кр/с
+    BLOG_PID_P,             // кр/с
+    BLOG_PID_I,             // кр/с
+    BLOG_PID_D,             // кр/с
+    BLOG_STEER_OFFSET,      // кр/с
+    BLOG_YAW_RATE,          // 0.01 °/с
+    BLOG_LEFT_SPEED,        // кр/с зі знаком
+    BLOG_RIGHT_SPEED,       // кр/с зі знаком
+    BLOG_LEFT_POS,          // кроки
+    BLOG_RIGHT_POS,         // кроки
+    BLOG_CMD_DIR,           // DirectionVector
+    BLOG_CMD_SPEED,         // 0..255
+    BLOG_CMD_STEER,         // 0..100
+    BLOG_FLAGS,             // TelemetryFlags
+    BLOG_TICK_US,           // тривалість такту
+
+    BLOG_FIELD_COUNT
+};
+
+// Біти BLOG_FLAGS; ті самі, що в TelemetryRecord::flags
+enum TelemetryFlags : uint8_t {
+    TELEM_LEFT_FORWARD  = 1 << 0,
+    TELEM_RIGHT_FORWARD = 1 << 1,
+    TELEM_FALLEN        = 1 << 2,
+    TELEM_LINK_LOST     = 1 << 3,
+};
+
+struct BinaryLog_FieldInfo {
+    const char* name;
+    float       scale;      // значення = raw * scale
+};
+
+static const BinaryLog_FieldInfo BLOG_FIELDS[BLOG_FIELD_COUNT] = {
+    { "time_ms",       1.0f  },
+    { "pitch",         0.01f },
+    { "roll",          0.01f },
+    { "gyro_y",        0.01f },
+    { "gyro_z",        0.01f },
+    { "acc_x",         1.0f  },
+    { "acc_y",         1.0f  },
+    { "acc_z",         1.0f  },
+    { "target_angle",  0.01f },
+    { "target_speed",  1.0f  },
+    { "base_speed",    1.0f  },
+    { "est_speed",     1.0f  },
+    { "pid_p",         1.0f  },
+    { "pid_i",         1.0f  },
+    { "pid_d",         1.0f  },
+    { "steer_offset",  1.0f  },
+    { "yaw_rate",      0.01f },
+    { "left_speed",    1.0f  },
+    { "right_speed",   1.0f  },
+    { "left_pos",      1.0f  },
+    { "right_pos",     1.0f  },
+    { "cmd_dir",       1.0f  },
+    { "cmd_speed",     1.0f  },
+    { "cmd_steer",     1.0f  },
+    { "flags",         1.0f  },
+    { "tick_us",       1.0f  },
+};
+
+struct BinaryLog_Sample {
+    int32_t v[BLOG_FIELD_COUNT];
+
+    void clear() { memset(v, 0, sizeof(v)); }
+
+    // Переведення з фізичних одиниць з округленням
+    void set(BinaryLog_Field f, float value) {
+        float raw = value / BLOG_FIELDS[f].scale;
+        v[f] = (int32_t)(raw >= 0 ? raw + 0.5f : raw - 0.5f);
+    }
+    float get(BinaryLog_Field f) const { return v[f] * BLOG_FIELDS[f].scale; }
+};
+
+// Стан такту як є — float і цілі без перетворень. Такт лише зберігає
+// значення; у фіксовану точку їх переводить toSample() під час
+// кодування (завантаження чорної скриньки, потік /log)
+struct BinaryLog_Tick {
+    uint32_t timeMs;
+    float    pitch, roll, gyroY, gyroZ;
+    int16_t  accX, accY, accZ;
+    float    targetAngle, targetSpeed, baseSpeed, estSpeed;
+    float    pidP, pidI, pidD;
+    float    steerOffset, yawRate, leftSpeed, rightSpeed;
+    int32_t  leftPos, rightPos;
+    uint8_t  cmdDir, cmdSpeed, cmdSteer, flags;
+    uint32_t tickUs;
+
+    void toSample(BinaryLog_Sample& s) const {
+        s.v[BLOG_TIME_MS] = (int32_t)timeMs;
+        s.set(BLOG_PITCH,        pitch);
+        s.set(BLOG_ROLL,         roll);
+        s.set(BLOG_GYRO_Y,       gyroY);
+        s.set(BLOG_GYRO_Z,       gyroZ);
+        s.v[BLOG_ACC_X] = accX;
+        s.v[BLOG_ACC_Y] = accY;
+        s.v[BLOG_ACC_Z] = accZ;
+        s.set(BLOG_TARGET_ANGLE, targetAngle);
+        s.set(BLOG_TARGET_SPEED, targetSpeed);
+        s.set(BLOG_BASE_SPEED,   baseSpeed);
+        s.set(BLOG_EST_SPEED,    estSpeed);
+        s.set(BLOG_PID_P,        pidP);
+        s.set(BLOG_PID_I,        pidI);
+        s.set(BLOG_PID_D,        pidD);
+        s.set(BLOG_STEER_OFFSET, steerOffset);
+        s.set(BLOG_YAW_RATE,     yawRate);
+        s.set(BLOG_LEFT_SPEED,   leftSpeed);
+        s.set(BLOG_RIGHT_SPEED,  rightSpeed);
+        s.v[BLOG_LEFT_POS]   = leftPos;
+        s.v[BLOG_RIGHT_POS]  = rightPos;
+        s.v[BLOG_CMD_DIR]    = cmdDir;
+        s.v[BLOG_CMD_SPEED]  = cmdSpeed;
+        s.v[BLOG_CMD_STEER]  = cmdSteer;
+        s.v[BLOG_FLAGS]      = flags;
+        s.v[BLOG_TICK_US]    = (int32_t)tickUs;
+    }
+};
+
+
+namespace BinaryLog {
+
+    static constexpr uint8_t  MAGIC[4]          = { 'B', 'B', 'L', 'G' };
+    static constexpr uint8_t  VERSION           = 2;
+    static constexpr uint16_t KEYFRAME_INTERVAL = 64;
+    static constexpr uint8_t  SYNC_KEY          = 0xA5;
+    static constexpr uint8_t  SYNC_DELTA        = 0x5A;
+
+    static constexpr size_t HEADER_SIZE      = 8;
+    static constexpr size_t MAX_PAYLOAD_SIZE = BLOG_FIELD_COUNT * 5;
+    static constexpr size_t RECORD_OVERHEAD  = 4;     // sync, seq, len, crc
+    static constexpr size_t MAX_RECORD_SIZE  = RECORD_OVERHEAD + MAX_PAYLOAD_SIZE;
+
+    static_assert(MAX_PAYLOAD_SIZE <= 255, "payload length must fit in u8");
+
+    inline size_t writeHeader(uint8_t* out) {
+        memcpy(out, MAGIC, 4);
+        out[4] = VERSION;
+        out[5] = BLOG_FIELD_COUNT;
+        out[6] = KEYFRAME_INTERVAL & 0xFF;
+        out[7] = KEYFRAME_INTERVAL >> 8;
+        return HEADER_SIZE;
+    }
+
+    inline size_t putVarint(uint8_t* out, int32_t value) {
+        uint32_t z = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+        size_t n = 0;
+        while (z >= 0x80) {
+            out[n++] = (uint8_t)(z | 0x80);
+            z >>= 7;
+        }
+        out[n++] = (uint8_t)z;
+        return n;
+    }
+
+    // 0 — не вистачає байтів або varint довший за 5 байт
+    inline size_t getVarint(const uint8_t* in, size_t len, int32_t& value) {
+        uint32_t z = 0;
+        for (size_t i = 0; i < len && i < 5; i++) {
+            z |= (uint32_t)(in[i] & 0x7F) << (7 * i);
+            if (!(in[i] & 0x80)) {
+                value = (int32_t)((z >> 1) ^ (~(z & 1) + 1));
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    // CRC-8 (поліном 0x07), без таблиці — запис короткий
+    inline uint8_t crc8(const uint8_t* data, size_t len) {
+        uint8_t crc = 0;
+        for (size_t i = 0; i < len; i++) {
+            crc ^= data[i];
+            for (int b = 0; b < 8; b++) {
+                crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+            }
+        }
+        return crc;
+    }
+
+}
+
+
+// =========================================================
+//  Кодер: стан між записами — лише попередній запис
+// =========================================================
+
+class BinaryLog_Encoder {
+
+private:
+
+    BinaryLog_Sample prev;
+    uint16_t sinceKey;
+    uint8_t  seq;
+
+public:
+
+    BinaryLog_Encoder() : sinceKey(BinaryLog::KEYFRAME_INTERVAL), seq(0) { prev.clear(); }
+
+    // Після втрати записів наступний має бути ключовим
+    void forceKeyframe() { sinceKey = BinaryLog::KEYFRAME_INTERVAL; }
+
+    // out — щонайменше BinaryLog::MAX_RECORD_SIZE байт
+    size_t encode(const BinaryLog_Sample& s, uint8_t* out) {
+        bool key = sinceKey >= BinaryLog::KEYFRAME_INTERVAL;
+        size_t n = 3;
+        for (size_t i = 0; i < BLOG_FIELD_COUNT; i++) {
+            int32_t value = key ? s.v[i] : (int32_t)((uint32_t)s.v[i] - (uint32_t)prev.v[i]);
+            n += BinaryLog::putVarint(out + n, value);
+        }
+        out[0] = key ? BinaryLog::SYNC_KEY : BinaryLog::SYNC_DELTA;
+        out[1] = seq++;
+        out[2] = (uint8_t)(n - 3);
+        out[n] = BinaryLog::crc8(out + 1, n - 1);
+        n++;
+        prev = s;
+        sinceKey = key ? 1 : sinceKey + 1;
+        return n;
+    }
+
+};
+
+
+// =========================================================
+//  Декодер: приймає потік шматками, повертає записи по одному
+//  Поля, яких немає у старішій версії файлу, лишаються 0.
+//  Після будь-якого пропуску (сміття, битий запис, дірка в seq)
+//  дельти ігноруються до наступного ключового запису
+// =========================================================
+
+class BinaryLog_Decoder {
+
+private:
+
+    BinaryLog_Sample prev;
+    uint8_t version;
+    uint8_t fieldCount;
+    bool    haveKey;
+    bool    haveSeq;
+    uint8_t nextSeq;
+
+    enum ParseResult { PARSE_OK, PARSE_SHORT, PARSE_CORRUPT };
+
+    // Розбір payload у s: PARSE_SHORT — бракує байтів, PARSE_CORRUPT — varint довший за 5 байт
+    ParseResult parseFields(const uint8_t* in, size_t len, bool key, BinaryLog_Sample& s, size_t& used) const {
+        size_t p = 0;
+        for (size_t i = 0; i < fieldCount; i++) {
+            int32_t value;
+            size_t n = BinaryLog::getVarint(in + p, len - p, value);
+            if (n == 0) return len - p >= 5 ? PARSE_CORRUPT : PARSE_SHORT;
+            p += n;
+            if (i < BLOG_FIELD_COUNT) {
+                s.v[i] = key ? value : (int32_t)((uint32_t)prev.v[i] + (uint32_t)value);
+            }
+        }
+        used = p;
+        return PARSE_OK;
+    }
+
+    size_t decodeRecord(const uint8_t* in, size_t len, size_t n, BinaryLog_Sample& out, bool& got) {
+        if (len - n < 3) return n;
+        uint8_t seq        = in[n + 1];
+        size_t  payloadLen = in[n + 2];
+        size_t  total      = payloadLen + BinaryLog::RECORD_OVERHEAD;
+        if (len - n < total) return n;
+
+        const uint8_t* payload = in + n + 3;
+        if (BinaryLog::crc8(in + n + 1, payloadLen + 2) != payload[payloadLen]) {
+            reject();
+            return n + 1;
+        }
+
+        bool key = in[n] == BinaryLog::SYNC_KEY;
+        bool gap = haveSeq && seq != nextSeq;
+        if (gap) lostRecords += (uint8_t)(seq - nextSeq);
+        haveSeq = true;
+        nextSeq = seq + 1;
+
+        if (!key && (gap || !haveKey)) {
+            // Дельта від запису, якого ми не бачили
+            haveKey = false;
+            return n + total;
+        }
+
+        BinaryLog_Sample s = prev;
+        size_t used;
+        if (parseFields(payload, payloadLen, key, s, used) != PARSE_OK || used != payloadLen) {
+            reject();
+            return n + total;
+        }
+        accept(s, out, got);
+        return n + total;
+    }
+
+    void accept(const BinaryLog_Sample& s, BinaryLog_Sample& out, bool& got) {
+        prev = s;
+        haveKey = true;
+        out = s;
+        got = true;
+    }
+
+    void reject() {
+        skippedBytes++;
+        badRecords++;
+        haveKey = false;
+        haveSeq = false;
+    }
+
+public:
+
+    uint32_t skippedBytes;
+    uint32_t badRecords;      // битий CRC або payload
+    uint32_t lostRecords;     // пропуски в seq
+
+    BinaryLog_Decoder()
+        : version(0), fieldCount(0), haveKey(false), haveSeq(false), nextSeq(0)
+        , skippedBytes(0), badRecords(0), lostRecords(0)
+    { prev.clear(); }
+
+    // false — не BBLG або непідтримувана версія
+    bool readHeader(const uint8_t* in, size_t len) {
+        if (len < BinaryLog::HEADER_SIZE || memcmp(in, BinaryLog::MAGIC, 4) != 0) return false;
+        if (in[4] != BinaryLog::VERSION) return false;
+        version = in[4];
+        fieldCount = in[5];
+        return true;
+    }
+
+    uint8_t getVersion() const { return version; }
+
+    // Повертає кількість спожитих байтів; 0 — потрібно більше даних.
+    // got = true, якщо out містить новий запис
+    size_t decode(const uint8_t* in, size_t len, BinaryLog_Sample& out, bool& got) {
+        got = false;
+        size_t n = 0;
+
+        // Пошук маркера запису (після втрат або сміття в потоці).
+        // Непотрібні дельти теж розбираються — межі та seq відомі з len/crc
+        while (n < len && in[n] != BinaryLog::SYNC_KEY && in[n] != BinaryLog::SYNC_DELTA) {
+            n++;
+            skippedBytes++;
+            haveKey = false;
+            haveSeq = false;
+        }
+        if (n >= len) return n;
+
+        return decodeRecord(in, len, n, out, got);
+    }
+
+};
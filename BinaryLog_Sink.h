@@ -0,0 +1,116 @@
+#pragma once
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+
+#include "BinaryLog_Format.h"
+#include "Spsc_RingBuffer.h"
+#include "WebRequest_Helpers.h"
+
+
+
+// =========================================================
+//  Буферизований запис бінарного логу в UART
+//  Такт керування кодує запис прямо в слот кільцевого буфера;
+//  фонове завдання пише в порт лише стільки, скільки вміщує TX-буфер
+//  Увімкнення: /log?enable=1 (за замовчуванням вимкнено — Serial
+//  спільний з текстовими повідомленнями)
+// =========================================================
+
+struct BinaryLog_Chunk {
+    uint8_t len;
+    uint8_t data[BinaryLog::MAX_RECORD_SIZE];
+};
+
+class BinaryLog_Sink {
+
+public:
+
+    static constexpr size_t   RING_SIZE       = 32;
+    static constexpr uint32_t DRAIN_PERIOD_MS = 5;
+
+private:
+
+    AsyncWebServer* server;
+    HardwareSerial& port;
+
+    Spsc_RingBuffer<BinaryLog_Chunk, RING_SIZE> ring;
+    BinaryLog_Encoder encoder;
+
+    volatile bool enabled;
+    bool     active;               // стан, який бачив виробник
+    volatile uint32_t dropped;     // пише лише виробник
+    volatile uint32_t written;     // пише лише споживач
+
+    static void drainTask(void* arg) {
+        BinaryLog_Sink* self = static_cast<BinaryLog_Sink*>(arg);
+        BinaryLog_Chunk chunk;
+        for (;;) {
+            while (self->ring.pop(chunk)) {
+                // Чекаємо місця в TX-буфері тут, а не в контурі керування
+                while (self->port.availableForWrite() < chunk.len) {
+                    vTaskDelay(1);
+                }
+                self->port.write(chunk.data, chunk.len);
+                self->written += chunk.len;
+            }
+            vTaskDelay(pdMS_TO_TICKS(DRAIN_PERIOD_MS));
+        }
+    }
+
+public:
+
+    BinaryLog_Sink(AsyncWebServer* server, HardwareSerial& port)
+        : server(server), port(port)
+        , enabled(false), active(false)
+        , dropped(0), written(0)
+    {}
+
+    void begin() {
+        server->on("/log", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            long enable;
+            if (WebRequest::intParam(req, "enable", enable)) {
+                enabled = enable != 0;
+            }
+            char body[80];
+            snprintf(body, sizeof(body),
+                     "{\"enabled\":%s,\"written\":%lu,\"dropped\":%lu}",
+                     enabled ? "true" : "false",
+                     (unsigned long)written, (unsigned long)dropped);
+            WebRequest::sendBuffer(req, WebRequest::appJson(), body);
+        });
+
+        xTaskCreatePinnedToCore(drainTask, "binlog", 2048, this, 1, nullptr, 0);
+    }
+
+    bool isEnabled() const { return enabled; }
+
+    // === Виробник: такт керування ===
+    void log(const BinaryLog_Sample& sample) {
+        bool en = enabled;
+        if (!en) { active = false; return; }
+
+        if (!active) {
+            // Новий сеанс — заголовок файлу і ключовий запис
+            BinaryLog_Chunk* hdr = ring.reserve();
+            if (!hdr) { dropped++; return; }
+            hdr->len = BinaryLog::writeHeader(hdr->data);
+            ring.commit();
+            encoder.forceKeyframe();
+            active = true;
+        }
+
+        BinaryLog_Chunk* c = ring.reserve();
+        if (!c) {
+            dropped++;
+            encoder.forceKeyframe();
+            return;
+        }
+        c->len = encoder.encode(sample, c->data);
+        ring.commit();
+    }
+
+    uint32_t getDropped() const { return dropped; }
+    uint32_t getWritten() const { return written; }
+
+};
@@ -0,0 +1,180 @@
+#pragma once
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <memory>
+
+#include "BinaryLog_Format.h"
+#include "WebRequest_Helpers.h"
+
+
+
+// =========================================================
+//  "Чорна скринька": останні DEPTH тактів керування в RAM
+//  Такт заповнює слот на місці (beginSample -> captureSample -> commit),
+//  без алокацій і перетворень: слот — сирі float (BinaryLog_Tick),
+//  у фіксовану точку їх переводить завантаження. При падінні або за запитом запис зупиняється,
+//  знімок віддається через HTTP у форматі бінарного логу (.bblog)
+//
+//  /blackbox/status  стан
+//  /blackbox/freeze  зупинити запис
+//  /blackbox/arm     відновити запис
+//  /blackbox         завантажити знімок (спершу зупиняє запис)
+// =========================================================
+
+enum BlackBoxReason : uint8_t {
+    BLACKBOX_RUNNING = 0,
+    BLACKBOX_FALL    = 1,
+    BLACKBOX_REQUEST = 2,
+};
+
+class BlackBox_Recorder {
+
+public:
+
+    static constexpr size_t DEPTH = 400;     // 4 с при 100 Гц, ~35 КБ
+
+private:
+
+    AsyncWebServer* server;
+
+    BinaryLog_Tick ticks[DEPTH];
+    uint32_t head;                            // записано тактів усього
+
+    volatile bool    frozen;
+    volatile bool    freezeRequested;         // з HTTP; виконує такт керування
+    volatile uint8_t reason;
+    volatile uint8_t readers;                 // активні завантаження
+    uint32_t freezeMs;
+
+    // Стан потокового завантаження
+    struct Download {
+        size_t   next;
+        size_t   count;
+        size_t   first;
+        bool     headerDone;
+        uint8_t  pending[BinaryLog::MAX_RECORD_SIZE];
+        size_t   pendingLen;
+        size_t   pendingOff;
+        BinaryLog_Encoder encoder;
+    };
+
+    size_t fill(Download& d, uint8_t* buf, size_t maxLen) {
+        size_t n = 0;
+        while (n < maxLen) {
+            if (d.pendingOff < d.pendingLen) {
+                size_t chunk = min(maxLen - n, d.pendingLen - d.pendingOff);
+                memcpy(buf + n, d.pending + d.pendingOff, chunk);
+                n += chunk;
+                d.pendingOff += chunk;
+                continue;
+            }
+            if (!d.headerDone) {
+                d.pendingLen = BinaryLog::writeHeader(d.pending);
+                d.headerDone = true;
+            } else if (d.next < d.count) {
+                BinaryLog_Sample s;
+                ticks[(d.first + d.next) % DEPTH].toSample(s);
+                d.pendingLen = d.encoder.encode(s, d.pending);
+                d.next++;
+            } else {
+                break;
+            }
+            d.pendingOff = 0;
+        }
+        return n;
+    }
+
+    void printStatus(char* buf, size_t len) const {
+        snprintf(buf, len,
+                 "{\"frozen\":%s,\"reason\":%u,\"samples\":%lu,\"depth\":%u,\"freezeMs\":%lu}",
+                 frozen ? "true" : "false", (unsigned)reason,
+                 (unsigned long)min((uint32_t)DEPTH, head), (unsigned)DEPTH,
+                 (unsigned long)freezeMs);
+    }
+
+public:
+
+    BlackBox_Recorder(AsyncWebServer* server)
+        : server(server), head(0)
+        , frozen(false), freezeRequested(false)
+        , reason(BLACKBOX_RUNNING), readers(0), freezeMs(0)
+    {}
+
+    void begin() {
+        // Конкретні шляхи раніше за "/blackbox" — він також ловить "/blackbox/*"
+        server->on("/blackbox/status", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            char body[112];
+            printStatus(body, sizeof(body));
+            WebRequest::sendBuffer(req, WebRequest::appJson(), body);
+        });
+
+        server->on("/blackbox/freeze", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            if (!frozen) freezeRequested = true;
+            WebRequest::sendOK(req);
+        });
+
+        server->on("/blackbox/arm", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            if (readers > 0) {
+                static const char BUSY[] PROGMEM = "download in progress";
+                WebRequest::sendText_P(req, 409, BUSY);
+                return;
+            }
+            rearm();
+            WebRequest::sendOK(req);
+        });
+
+        server->on("/blackbox", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            if (!frozen) {
+                // Зупинку виконає наступний такт (≤ 10 мс) — тоді повторити запит
+                freezeRequested = true;
+                static const char RETRY[] PROGMEM = "freezing, retry";
+                WebRequest::sendText_P(req, 409, RETRY);
+                return;
+            }
+
+            std::shared_ptr<Download> d(new Download());
+            size_t count = min((uint32_t)DEPTH, head);
+            d->count = count;
+            d->first = head - count;
+
+            readers++;
+            req->onDisconnect([this]() { readers--; });
+
+            AsyncWebServerResponse *res = req->beginChunkedResponse(WebRequest::appOctet(),
+                [this, d](uint8_t *buf, size_t maxLen, size_t) -> size_t {
+                    return fill(*d, buf, maxLen);
+                });
+            res->addHeader("Content-Disposition", "attachment; filename=\"blackbox.bblog\"");
+            req->send(res);
+        });
+    }
+
+    // === Такт керування ===
+    // nullptr — запис зупинено
+    BinaryLog_Tick* beginSample() {
+        if (freezeRequested && !frozen) freeze(BLACKBOX_REQUEST);
+        if (frozen) return nullptr;
+        return &ticks[head % DEPTH];
+    }
+
+    void commit() { head++; }
+
+    void freeze(BlackBoxReason why) {
+        if (frozen) return;
+        frozen          = true;
+        freezeRequested = false;
+        reason          = why;
+        freezeMs        = millis();
+    }
+
+    void rearm() {
+        head            = 0;
+        reason          = BLACKBOX_RUNNING;
+        freezeRequested = false;
+        frozen          = false;
+    }
+
+    bool isFrozen() const { return frozen; }
+
+};
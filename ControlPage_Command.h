@@ -0,0 +1,118 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <limits.h>
+
+
+
+// =========================================================
+//  Команда керування і розбір параметрів запитів
+//  Не залежить від Arduino і веб-сервера — ControlPage_Router лише
+//  дістає рядки з запиту, решта тут: чисті функції без алокацій
+// =========================================================
+
+enum DirectionVector {
+    STOP = 0,
+    FORWARD = 1,
+    BACKWARD = 2,
+    LEFT = 3,
+    RIGHT = 4,
+    FORWARD_LEFT = 5,
+    FORWARD_RIGHT = 6,
+    BACKWARD_LEFT = 7,
+    BACKWARD_RIGHT = 8
+};
+
+struct ControlCommand {
+    DirectionVector direction;
+    uint8_t speed;
+    uint8_t steer;
+
+    bool operator==(const ControlCommand& o) const {
+        return direction == o.direction && speed == o.speed && steer == o.steer;
+    }
+    bool operator!=(const ControlCommand& o) const { return !(*this == o); }
+};
+
+
+namespace ControlParse {
+
+    inline long clampLong(long x, long lo, long hi) {
+        return x < lo ? lo : (x > hi ? hi : x);
+    }
+
+    // Ціле число зі знаком; false — параметра немає або він не число
+    inline bool parseLong(const char* str, long& out) {
+        if (!str) return false;
+        bool neg = false;
+        if (*str == '-' || *str == '+') neg = (*str++ == '-');
+        if (*str < '0' || *str > '9') return false;
+
+        long value = 0;
+        while (*str >= '0' && *str <= '9') {
+            if (value <= (LONG_MAX - 9) / 10) value = value * 10 + (*str - '0');
+            str++;
+        }
+        out = neg ? -value : value;
+        return true;
+    }
+
+    inline DirectionVector parseDirection(const char* dir) {
+        static const struct { const char* name; DirectionVector dir; } table[] = {
+            { "forward",        FORWARD        },
+            { "backward",       BACKWARD       },
+            { "left",           LEFT           },
+            { "right",          RIGHT          },
+            { "forward_left",   FORWARD_LEFT   },
+            { "forward_right",  FORWARD_RIGHT  },
+            { "backward_left",  BACKWARD_LEFT  },
+            { "backward_right", BACKWARD_RIGHT },
+        };
+        for (const auto& e : table) {
+            if (strcmp(dir, e.name) == 0) return e.dir;
+        }
+        return STOP;
+    }
+
+    // v/h ∈ [-1; 1] → DirectionVector, індекс = (v + 1) * 3 + (h + 1)
+    inline DirectionVector directionFromAxes(int v, int h) {
+        static const DirectionVector table[9] = {
+            BACKWARD_LEFT, BACKWARD, BACKWARD_RIGHT,
+            LEFT,          STOP,     RIGHT,
+            FORWARD_LEFT,  FORWARD,  FORWARD_RIGHT
+        };
+        return table[(v + 1) * 3 + (h + 1)];
+    }
+
+    // /move?v=&h=&s= → команда. Відсутній параметр — nullptr:
+    // v/h вважаються 0, швидкість лишається попередньою
+    inline void applyMove(ControlCommand& cmd, const char* vStr, const char* hStr, const char* sStr) {
+        long v = 0;
+        long h = 0;
+        long s = cmd.speed;
+
+        parseLong(vStr, v);
+        parseLong(hStr, h);
+        if (parseLong(sStr, s)) {
+            s = clampLong(s, 0, 255);
+        }
+
+        // Нормалізуємо v та h до діапазону [-1; 1]
+        v = clampLong(v, -1, 1);
+        h = clampLong(h, -1, 1);
+
+        // Мапінг v/h → DirectionVector
+        cmd.direction = directionFromAxes(v, h);
+
+        // Швидкість прямо з слайдера
+        cmd.speed = s;
+
+        // Steer: грубо мапимо h на 0..100 (0=макс. вліво, 50=прямо, 100=макс. вправо)
+        uint8_t steer = 50;
+        if (h < 0)      steer = 0;
+        else if (h > 0) steer = 100;
+        cmd.steer = steer;
+    }
+
+}
@@ -4,22 +4,18 @@
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 
-enum DirectionVector {
-    STOP = 0,
-    FORWARD = 1,   
-    BACKWARD = 2,  
-    LEFT = 3,      
-    RIGHT = 4,   
-    FORWARD_LEFT = 5,
-    FORWARD_RIGHT = 6,
-    BACKWARD_LEFT = 7,
-    BACKWARD_RIGHT = 8
-};
-
-struct ControlCommand {
-    DirectionVector direction;
-    uint8_t speed;
-    uint8_t steer;
+#include "LinkQuality_Monitor.h"
+#include "NetworkConnection_Manager.h"
+#include "Heap_Monitor.h"
+#include "DeferredLog_Manager.h"
+#include "ControlPage_Command.h"
+#include "WebRequest_Helpers.h"
+
+// Стиснута сторінка у flash (генерує tools/embed_page.py)
+struct ControlPage_Asset {
+    const uint8_t* gzData;
+    size_t         gzLength;
+    const char*    etag;
 };
 
 class ControlPage_Router {
@@ -27,133 +23,199 @@ private:
     ControlCommand command;
     AsyncWebServer* server;
 
+    // Час останньої команди / keep-alive від сторінки (millis)
+    volatile unsigned long lastCommandMs;
+
+    void stampCommand() { lastCommandMs = millis(); }
+
+    // === Якість зв'язку ===
+    LinkQuality_Monitor linkStats;
+    NetworkConnection_Manager* network;
+    unsigned long lastRssiMs;
+
+    static constexpr unsigned long RSSI_PERIOD_MS = 1000;
+
+    static uint32_t clientIP(AsyncWebServerRequest *req) {
+        return (uint32_t)req->client()->remoteIP();
+    }
+
+    void sampleRssi() {
+        if (!network) return;
+        unsigned long now = millis();
+        if (now - lastRssiMs < RSSI_PERIOD_MS) return;
+        lastRssiMs = now;
+        linkStats.onRssi(network->getRSSI());
+        heap.sample();
+    }
+
+    // === Пам'ять ===
+    Heap_Monitor heap;
+
 public:
-    ControlPage_Router(AsyncWebServer* server) : server(server) {
+    ControlPage_Router(AsyncWebServer* server)
+        : server(server), lastCommandMs(0), network(nullptr), lastRssiMs(0) {
         command.direction = STOP;
         command.speed = 150;
         command.steer = 50;
     }
 
-    void setupRoutes(const char *HTML) {  
-        // Головна сторінка
-        server->on("/", HTTP_GET, [HTML](AsyncWebServerRequest *req) {
-            req->send(200, "text/html; charset=utf-8", HTML);
+    void attachNetwork(NetworkConnection_Manager* net) { network = net; }
+
+    void setupRoutes(const ControlPage_Asset& page) {  
+        // ═══════════════════════════════════════════════════════
+        //  ГОЛОВНА СТОРІНКА
+        //  gzip з flash шматками (AsyncProgmemResponse), без копії в RAM.
+        //  no-cache + сильний ETag: браузер щоразу перевіряє, але
+        //  незмінену сторінку отримує як 304 без тіла
+        // ═══════════════════════════════════════════════════════
+        server->on("/", HTTP_GET, [page](AsyncWebServerRequest *req) {
+            const AsyncWebHeader* inm = WebRequest::findHeader(req, "If-None-Match");
+            if (inm && strcmp(inm->value().c_str(), page.etag) == 0) {
+                AsyncWebServerResponse *res = req->beginResponse(304);
+                res->addHeader("ETag", page.etag);
+                res->addHeader("Cache-Control", "no-cache");
+                req->send(res);
+                return;
+            }
+
+            AsyncWebServerResponse *res = req->beginResponse_P(200, WebRequest::textHtml(), page.gzData, page.gzLength);
+            res->addHeader("Content-Encoding", "gzip");
+            res->addHeader("ETag", page.etag);
+            res->addHeader("Cache-Control", "no-cache");
+            req->send(res);
         });
 
         // Ping
-        server->on("/ping", HTTP_GET, [](AsyncWebServerRequest *req) {
-            String msg = "PONG, ip = ";
-            msg += (WiFi.getMode() == WIFI_STA) ? WiFi.localIP().toString() : WiFi.softAPIP().toString();
-            req->send(200, "text/plain", msg);
+        server->on("/ping", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            char body[40] = "PONG, ip = ";
+            size_t len = strlen(body);
+            if (network) {
+                network->formatIP(body + len, sizeof(body) - len);
+            }
+            WebRequest::sendBuffer(req, WebRequest::textPlain(), body);
+        });
+
+        // Стан купи: вільно, найбільший блок, мінімуми з моменту старту
+        server->on("/heap", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            heap.sample();
+            char body[160];
+            heap.formatJson(body, sizeof(body));
+            WebRequest::sendBuffer(req, WebRequest::appJson(), body);
         });
 
         // ═══════════════════════════════════════════════════════
-        //  НОВИЙ МАРШРУТ /move ДЛЯ ГЕЙМПАДУ
-        //  move?v=-1..1&h=-1..1&s=0..255
-        //  v:  1 = вперед, -1 = назад, 0 = стоп по вертикалі
-        //  h:  1 = вправо, -1 = вліво, 0 = прямо
-        //  s:  швидкість 0..255
+        //  ECHO ДЛЯ ВИМІРЮВАННЯ RTT
+        //  echo?t=<час клієнта>&r=<попередній RTT, мс>
+        //  t повертається без змін, сторінка рахує RTT сама
         // ═══════════════════════════════════════════════════════
-        server->on("/move", HTTP_GET, [this](AsyncWebServerRequest *req) {
-            int v = 0;
-            int h = 0;
-            int s = command.speed;
-
-            if (req->hasParam("v")) {
-                v = req->getParam("v")->value().toInt();
-            }
-            if (req->hasParam("h")) {
-                h = req->getParam("h")->value().toInt();
-            }
-            if (req->hasParam("s")) {
-                s = constrain(req->getParam("s")->value().toInt(), 0, 255);
+        server->on("/echo", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            long t = 0;
+            long rtt;
+            WebRequest::intParam(req, "t", t);
+            if (WebRequest::intParam(req, "r", rtt)) {
+                linkStats.onRtt(rtt);
             }
+            sampleRssi();
 
-            // Нормалізуємо v та h до діапазону [-1; 1]
-            v = constrain(v, -1, 1);
-            h = constrain(h, -1, 1);
-
-            // Мапінг v/h → DirectionVector
-            if (v == 0 && h == 0) {
-                command.direction = STOP;
-            } else if (v == 1 && h == 0) {
-                command.direction = FORWARD;
-            } else if (v == -1 && h == 0) {
-                command.direction = BACKWARD;
-            } else if (v == 0 && h == -1) {
-                command.direction = LEFT;
-            } else if (v == 0 && h == 1) {
-                command.direction = RIGHT;
-            } else if (v == 1 && h == -1) {
-                command.direction = FORWARD_LEFT;
-            } else if (v == 1 && h == 1) {
-                command.direction = FORWARD_RIGHT;
-            } else if (v == -1 && h == -1) {
-                command.direction = BACKWARD_LEFT;
-            } else if (v == -1 && h == 1) {
-                command.direction = BACKWARD_RIGHT;
-            } else {
-                command.direction = STOP;
-            }
+            const LinkQuality_Monitor::ClientStats* c = linkStats.findClient(clientIP(req));
 
-            // Швидкість прямо з слайдера
-            command.speed = s;
-
-            // Steer: грубо мапимо h на 0..100 (0=макс. вліво, 50=прямо, 100=макс. вправо)
-            uint8_t steer = 50;
-            if (h < 0)      steer = 0;
-            else if (h > 0) steer = 100;
-            command.steer = steer;
+            char body[96];
+            snprintf(body, sizeof(body),
+                     "{\"t\":%ld,\"ms\":%lu,\"rssi\":%d,\"received\":%lu,\"lost\":%lu}",
+                     t, millis(), linkStats.getLastRssi(),
+                     c ? (unsigned long)c->received : 0UL,
+                     c ? (unsigned long)c->lost : 0UL);
+            WebRequest::sendBuffer(req, WebRequest::appJson(), body);
+        });
 
-            // Для налагодження — виводимо поточну команду в Serial
-            this->printCommand();
+        // Повна статистика зв'язку (гістограми) для інструментів
+        server->on("/link", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            if (WebRequest::findParam(req, "reset")) {
+                linkStats.reset();
+            }
+            AsyncResponseStream *res = req->beginResponseStream(WebRequest::appJson());
+            linkStats.printJson(*res);
+            req->send(res);
+        });
 
-            req->send(200, "text/plain", "OK");
+        // ═══════════════════════════════════════════════════════
+        //  НОВИЙ МАРШРУТ /move ДЛЯ ГЕЙМПАДУ
+        //  move?v=-1..1&h=-1..1&s=0..255&n=<seq>
+        //  v:  1 = вперед, -1 = назад, 0 = стоп по вертикалі
+        //  h:  1 = вправо, -1 = вліво, 0 = прямо
+        //  s:  швидкість 0..255
+        //  n:  порядковий номер запиту (для підрахунку втрат)
+        // ═══════════════════════════════════════════════════════
+        server->on("/move", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            ControlCommand before = command;
+            ControlParse::applyMove(command, WebRequest::findParam(req, "v"),
+                                             WebRequest::findParam(req, "h"),
+                                             WebRequest::findParam(req, "s"));
+            stampCommand();
+
+            long sid = 0, seq = 0;
+            WebRequest::intParam(req, "sid", sid);
+            WebRequest::intParam(req, "n", seq);
+            linkStats.onCommand(clientIP(req), sid > 0 ? (uint32_t)sid : 0,
+                                seq > 0 ? (uint32_t)seq : 0, millis());
+            sampleRssi();
+
+            // Для налагодження — команда в лог лише при зміні: сторінка
+            // повторює /move і без руху, як keep-alive
+            if (command != before) this->printCommand();
+
+            WebRequest::sendOK(req);
         });
 
         // ═══════════════════════════════════════════════════════
         //  КОМБІНАЦІЇ НАПРЯМКІВ
         // ═══════════════════════════════════════════════════════
         server->on("/direction", HTTP_GET, [this](AsyncWebServerRequest *req) {
-            if (req->hasParam("val")) {
-                String dir = req->getParam("val")->value();
-                
+            const char* dir = WebRequest::findParam(req, "val");
+            if (dir) {
                 // Парсинг рядка в DirectionVector
-                if      (dir == "forward")        command.direction = FORWARD;
-                else if (dir == "backward")       command.direction = BACKWARD;
-                else if (dir == "left")           command.direction = LEFT;
-                else if (dir == "right")          command.direction = RIGHT;
-                else if (dir == "forward_left")   command.direction = FORWARD_LEFT;
-                else if (dir == "forward_right")  command.direction = FORWARD_RIGHT;
-                else if (dir == "backward_left")  command.direction = BACKWARD_LEFT;
-                else if (dir == "backward_right") command.direction = BACKWARD_RIGHT;
-                else                              command.direction = STOP;
+                command.direction = ControlParse::parseDirection(dir);
+                stampCommand();
             }
-            req->send(200, "text/plain", "OK");
+            WebRequest::sendOK(req);
         });
 
         // Speed slider
         server->on("/speed", HTTP_GET, [this](AsyncWebServerRequest *req) {
-            if (req->hasParam("val")) {
-                command.speed = constrain(req->getParam("val")->value().toInt(), 0, 255);
+            long val;
+            if (WebRequest::intParam(req, "val", val)) {
+                command.speed = constrain(val, 0L, 255L);
+                stampCommand();
             }
-            req->send(200, "text/plain", "OK");
+            WebRequest::sendOK(req);
         });
 
         // Steer slider
         server->on("/steer", HTTP_GET, [this](AsyncWebServerRequest *req) {
-            if (req->hasParam("val")) {
-                command.steer = constrain(req->getParam("val")->value().toInt(), 0, 100);
+            long val;
+            if (WebRequest::intParam(req, "val", val)) {
+                command.steer = constrain(val, 0L, 100L);
+                stampCommand();
             }
-            req->send(200, "text/plain", "OK");
+            WebRequest::sendOK(req);
         });
 
         server->begin();
-        Serial.println("✓ Web server started");
+        LOG_I("✓ Web server started");
     }
 
     ControlCommand getCommand() { return command; }
+
+    // Скільки мс минуло з останньої команди / keep-alive
+    unsigned long getCommandAgeMs() const { return millis() - lastCommandMs; }
+
+    bool isLinkAlive(unsigned long timeoutMs) const {
+        return lastCommandMs != 0 && getCommandAgeMs() < timeoutMs;
+    }
     
+    const LinkQuality_Monitor& getLinkStats() const { return linkStats; }
+    const Heap_Monitor&        getHeapStats() const { return heap; }
+
     void resetCommand() {
         command.direction = STOP;
         command.speed = 150;
@@ -165,11 +227,7 @@ public:
             "STOP", "FORWARD", "BACKWARD", "LEFT", "RIGHT",
             "FORWARD_LEFT", "FORWARD_RIGHT", "BACKWARD_LEFT", "BACKWARD_RIGHT"
         };
-        Serial.print("Direction: ");
-        Serial.print(dirNames[command.direction]);
-        Serial.print(" | Speed: ");
-        Serial.print(command.speed);
-        Serial.print(" | Steer: ");
-        Serial.println(command.steer);
+        LOG_I("Direction: %s | Speed: %u | Steer: %u",
+              dirNames[command.direction], (unsigned)command.speed, (unsigned)command.steer);
     }
 };
\ No newline at end of file
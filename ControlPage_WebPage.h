@@ -1,5 +1,8 @@
 #pragma once
 
+// Джерело сторінки. У прошивку йде стиснута копія з ControlPage_WebPageGz.h —
+// після змін тут запустіть: python3 tools/embed_page.py
+
 const char* controlPageHTML = R"rawHTML(
 <!DOCTYPE html>
 <html lang="uk">
@@ -73,6 +76,11 @@ const char* controlPageHTML = R"rawHTML(
         .rot-left { transform: rotate(180deg); }
 
         .sliders { display: flex; flex-direction: column; gap: 20px; }
+
+        /* Живий графік телеметрії */
+        .plot { padding: 0 20px 10px; }
+        .plot canvas { width: 100%; height: 140px; background: #fff; border-radius: 10px; }
+        .plot-legend { font-size: 12px; color: var(--icon-color); display: flex; gap: 15px; }
         input[type=range] { height: 150px; writing-mode: bt-lr; appearance: slider-vertical; }
     </style>
 </head>
@@ -80,6 +88,7 @@ const char* controlPageHTML = R"rawHTML(
 
 <header>
     <div>BALANCE BOT</div>
+    <div id="linkDisplay">RTT -- | RSSI -- | LOSS --</div>
     <div onclick="setIP()"><span id="ipDisplay">...</span> ✎</div>
 </header>
 
@@ -101,6 +110,16 @@ const char* controlPageHTML = R"rawHTML(
     </div>
 </div>
 
+<div class="plot">
+    <canvas id="telemetryPlot"></canvas>
+    <div class="plot-legend">
+        <span style="color:#e53935">■ pitch °</span>
+        <span style="color:#1e88e5">■ target °</span>
+        <span style="color:#43a047">■ base speed</span>
+        <span id="telemetryStats">WS --</span>
+    </div>
+</div>
+
 <script>
     let robotIP = localStorage.getItem('robotIP') || window.location.hostname;
     document.getElementById('ipDisplay').innerText = robotIP;
@@ -108,6 +127,16 @@ const char* controlPageHTML = R"rawHTML(
     // Словник станів: які кнопки зараз натиснуті
     const inputs = { f: 0, b: 0, l: 0, r: 0 };
     let lastQuery = "";
+    let lastSentMs = 0;
+
+    // Keep-alive: навіть без змін повторюємо команду, інакше робот
+    // вважає зв'язок втраченим і плавно зупиняється
+    const KEEPALIVE_MS = 200;
+
+    // Порядковий номер /move — робот рахує втрати по розривах.
+    // sid — сеанс цього завантаження: після перезавантаження seq знову з 1
+    let seq = 0;
+    const sid = Math.floor(Math.random() * 0x7FFFFFFE) + 1;
 
     // Налаштування обробників для кнопок
     setupBtn("btn-f", 'f');
@@ -133,13 +162,113 @@ const char* controlPageHTML = R"rawHTML(
 
         const currentQuery = `move?v=${v}&h=${h}&s=${s}`;
         
-        // Відправляємо запит ТІЛЬКИ якщо стан змінився
-        if (currentQuery !== lastQuery) {
-            fetch(`http://${robotIP}/${currentQuery}`).catch(()=>{});
+        // Відправляємо запит якщо стан змінився або настав час keep-alive
+        const now = Date.now();
+        if (currentQuery !== lastQuery || now - lastSentMs >= KEEPALIVE_MS) {
+            fetch(`http://${robotIP}/${currentQuery}&sid=${sid}&n=${++seq}`).catch(()=>{});
             lastQuery = currentQuery;
+            lastSentMs = now;
         }
     }, 50);
 
+    // Вимірювання RTT: раз на секунду /echo, попередній RTT передаємо роботу
+    let lastRtt = -1;
+    setInterval(() => {
+        const t0 = Math.round(performance.now());
+        fetch(`http://${robotIP}/echo?t=${t0}&r=${lastRtt}`)
+            .then(r => r.json())
+            .then(d => {
+                lastRtt = Math.round(performance.now()) - d.t;
+                const total = d.received + d.lost;
+                const loss = total ? (100 * d.lost / total).toFixed(1) : '0.0';
+                document.getElementById('linkDisplay').innerText =
+                    `RTT ${lastRtt} ms | RSSI ${d.rssi} dBm | LOSS ${loss}%`;
+            })
+            .catch(() => {
+                document.getElementById('linkDisplay').innerText = 'RTT -- | LINK DOWN';
+            });
+    }, 1000);
+
+    // ═══════════════════════════════════════════════════════
+    //  ТЕЛЕМЕТРІЯ: бінарний WebSocket /telemetry
+    //  Повідомлення: [version u8][recordSize u8][count u16][dropped u32]
+    //  + count записів TelemetryRecord (little-endian, див. Telemetry_Stream.h)
+    //  Робот шле пакети лише у відповідь на "p": наступний запит — після
+    //  відповіді (не частіше PULL_MS) або через PULL_IDLE_MS, якщо даних не було
+    // ═══════════════════════════════════════════════════════
+    const PLOT_POINTS = 300;
+    const plot = { pitch: [], target: [], base: [] };
+    let telemetryDropped = 0;
+    const PULL_MS = 50, PULL_IDLE_MS = 250;
+
+    function connectTelemetry() {
+        const ws = new WebSocket(`ws://${robotIP}/telemetry`);
+        ws.binaryType = 'arraybuffer';
+
+        let lastPull = 0, answered = true;
+        const pull = () => {
+            if (ws.readyState !== WebSocket.OPEN) return;
+            ws.send('p');
+            lastPull = Date.now();
+            answered = false;
+        };
+        const timer = setInterval(() => {
+            const since = Date.now() - lastPull;
+            if ((answered && since >= PULL_MS) || since >= PULL_IDLE_MS) pull();
+        }, PULL_MS);
+        ws.onopen = pull;
+
+        ws.onmessage = (ev) => {
+            answered = true;
+            const dv = new DataView(ev.data);
+            if (dv.getUint8(0) !== 1) return;
+            const size = dv.getUint8(1);
+            const count = dv.getUint16(2, true);
+            telemetryDropped = dv.getUint32(4, true);
+            for (let i = 0; i < count; i++) {
+                const o = 8 + i * size;
+                push(plot.pitch,  dv.getFloat32(o + 12, true));
+                push(plot.target, dv.getFloat32(o + 20, true));
+                push(plot.base,   dv.getFloat32(o + 24, true));
+            }
+        };
+        ws.onclose = () => { clearInterval(timer); setTimeout(connectTelemetry, 1000); };
+    }
+
+    function push(arr, v) {
+        arr.push(v);
+        if (arr.length > PLOT_POINTS) arr.shift();
+    }
+
+    function drawPlot() {
+        const c = document.getElementById('telemetryPlot');
+        const w = c.width = c.clientWidth;
+        const h = c.height = c.clientHeight;
+        const g = c.getContext('2d');
+        g.strokeStyle = '#cfd8dc';
+        g.beginPath(); g.moveTo(0, h / 2); g.lineTo(w, h / 2); g.stroke();
+
+        const line = (arr, scale, color) => {
+            g.strokeStyle = color;
+            g.beginPath();
+            arr.forEach((v, i) => {
+                const x = i * w / PLOT_POINTS;
+                const y = h / 2 - Math.max(-1, Math.min(1, v / scale)) * h / 2;
+                i ? g.lineTo(x, y) : g.moveTo(x, y);
+            });
+            g.stroke();
+        };
+        line(plot.pitch,  45,    '#e53935');
+        line(plot.target, 45,    '#1e88e5');
+        line(plot.base,   50000, '#43a047');
+
+        document.getElementById('telemetryStats').innerText = `dropped ${telemetryDropped}`;
+        requestAnimationFrame(drawPlot);
+    }
+
+    connectTelemetry();
+    requestAnimationFrame(drawPlot);
+
     function setIP() {
         let res = prompt("IP адреса:", robotIP);
         if(res) { robotIP = res; localStorage.setItem('robotIP', res); location.reload(); }
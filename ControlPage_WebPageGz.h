@@ -0,0 +1,193 @@
+#pragma once
+
+// =========================================================
+//  ЗГЕНЕРОВАНО tools/embed_page.py з ControlPage_WebPage.h
+//  Не редагувати вручну
+//  raw: 10804 B, minified: 6877 B, gzip: 2853 B
+// =========================================================
+
+#include <Arduino.h>
+
+static const char controlPageETag[] = "\"45fcc24765748ce9\"";
+
+static const uint8_t controlPageGz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0xdd, 0x6e, 0xdb, 0x46,
+    0x16, 0xbe, 0xd7, 0x53, 0x4c, 0x95, 0x34, 0x22, 0x1b, 0x89, 0xa2, 0x6c, 0x2b, 0x71, 0x2c, 0x4b,
+    0x41, 0x1c, 0x3b, 0x58, 0xa3, 0x4e, 0xec, 0x8d, 0x9d, 0x06, 0x8b, 0xa0, 0xa8, 0x29, 0x72, 0x24,
+    0x4d, 0x4d, 0x91, 0xec, 0x70, 0x24, 0x59, 0x4d, 0x04, 0x6c, 0xf7, 0x01, 0x76, 0xef, 0x7a, 0xb5,
+    0x17, 0xfb, 0x08, 0x41, 0xb1, 0xc5, 0x5e, 0xec, 0x6e, 0x0b, 0xec, 0x13, 0x38, 0xaf, 0xd0, 0x27,
+    0xd9, 0xef, 0xcc, 0x90, 0x14, 0xe5, 0xbf, 0x6c, 0x81, 0x6e, 0x81, 0x58, 0xe4, 0x99, 0x33, 0xe7,
+    0x9c, 0x39, 0x3f, 0xdf, 0x39, 0xc3, 0x6e, 0x7f, 0xb2, 0x7b, 0xf8, 0xf4, 0xe4, 0x0f, 0x47, 0x7b,
+    0x6c, 0xa4, 0xc6, 0x61, 0xaf, 0xb2, 0x4d, 0x3f, 0x2c, 0xf4, 0xa2, 0x61, 0xb7, 0x3a, 0x39, 0xab,
+    0x12, 0x81, 0x7b, 0x01, 0x7e, 0xc6, 0x5c, 0x79, 0xcc, 0x1f, 0x79, 0x32, 0xe5, 0xaa, 0x5b, 0x7d,
+    0x75, 0xf2, 0xac, 0xb1, 0x59, 0xcd, 0xc9, 0x91, 0x37, 0xe6, 0xdd, 0xea, 0x54, 0xf0, 0x59, 0x12,
+    0x4b, 0x55, 0x65, 0x7e, 0x1c, 0x29, 0x1e, 0x81, 0x6d, 0x26, 0x02, 0x35, 0xea, 0x06, 0x7c, 0x2a,
+    0x7c, 0xde, 0xd0, 0x2f, 0x75, 0x26, 0x22, 0xa1, 0x84, 0x17, 0x36, 0x52, 0xdf, 0x0b, 0x79, 0xb7,
+    0xe5, 0xb8, 0x75, 0x36, 0xf6, 0xce, 0xc5, 0x78, 0x32, 0x2e, 0x93, 0x26, 0x29, 0x97, 0xfa, 0xdd,
+    0xeb, 0x83, 0x14, 0xc5, 0xa4, 0x4b, 0x09, 0x15, 0xf2, 0xde, 0x0e, 0x68, 0x91, 0xcf, 0xd9, 0x4e,
+    0xac, 0xd8, 0x53, 0x28, 0x92, 0x71, 0x18, 0x72, 0xb9, 0xdd, 0x34, 0xab, 0x95, 0xed, 0x54, 0xcd,
+    0xe9, 0x77, 0x4b, 0xc6, 0x60, 0x78, 0x5b, 0x69, 0x34, 0x12, 0x29, 0xc6, 0x9e, 0x9c, 0x37, 0xfc,
+    0x38, 0x8c, 0xe5, 0x16, 0xbb, 0xb3, 0xf6, 0x60, 0x7d, 0x6d, 0x7d, 0xb3, 0x83, 0x95, 0xfe, 0xb0,
+    0x20, 0x72, 0x9f, 0x0f, 0x06, 0x2d, 0x4d, 0x54, 0x11, 0x16, 0x40, 0x1a, 0xe8, 0xff, 0x72, 0x92,
+    0xe7, 0x2b, 0x31, 0xe5, 0x20, 0x3f, 0xf0, 0x82, 0x47, 0x0f, 0xdb, 0x44, 0x16, 0x38, 0x67, 0x21,
+    0xa0, 0xbd, 0xf1, 0x80, 0x3f, 0xf4, 0x3a, 0x95, 0x45, 0xa5, 0x1f, 0x07, 0x73, 0x28, 0x1e, 0xc0,
+    0xb6, 0xc6, 0xc0, 0x1b, 0x8b, 0x70, 0xbe, 0xc5, 0x52, 0x2f, 0x4a, 0x1b, 0x38, 0x92, 0x80, 0xbc,
+    0xbe, 0xe7, 0x9f, 0x0d, 0x65, 0x3c, 0x89, 0x82, 0x7c, 0xf3, 0xd4, 0x93, 0xd6, 0xd2, 0x1a, 0xbb,
+    0x53, 0x81, 0xbd, 0x43, 0x11, 0x6d, 0x31, 0xb7, 0x53, 0x09, 0x44, 0x9a, 0x84, 0x1e, 0x44, 0x0c,
+    0x42, 0x7e, 0xde, 0xa9, 0xd0, 0xdf, 0x46, 0x20, 0x24, 0x87, 0x39, 0x31, 0x38, 0xb0, 0x63, 0x32,
+    0x8e, 0x3a, 0x95, 0x11, 0x17, 0xc3, 0x91, 0xda, 0x62, 0x2d, 0xd7, 0x9d, 0x8e, 0x3a, 0x15, 0xe3,
+    0x3e, 0x1e, 0x82, 0x6d, 0x8b, 0x45, 0x71, 0xc4, 0x61, 0xef, 0x8c, 0xf7, 0xcf, 0x84, 0x6a, 0x5c,
+    0xb3, 0xa4, 0xe2, 0x89, 0x3f, 0xd2, 0x27, 0x24, 0x91, 0x86, 0xb6, 0xa8, 0x50, 0xe0, 0xb9, 0xc4,
+    0x49, 0x6e, 0x32, 0x78, 0xc5, 0xb1, 0xb0, 0x3a, 0x5b, 0x9c, 0x8d, 0x84, 0x82, 0x80, 0xc4, 0x0b,
+    0x02, 0x11, 0xc1, 0x91, 0xad, 0x76, 0x72, 0x7e, 0xe5, 0x1c, 0x5f, 0x4f, 0x52, 0x25, 0x06, 0xb4,
+    0x57, 0xa7, 0x0a, 0x3c, 0x94, 0x78, 0xc8, 0x91, 0x3e, 0x57, 0x33, 0xce, 0x23, 0x52, 0xef, 0x0c,
+    0x91, 0x55, 0x10, 0xa2, 0x59, 0x3c, 0x11, 0x69, 0x53, 0xae, 0xf1, 0x06, 0x14, 0xdc, 0x28, 0xce,
+    0xd3, 0x56, 0x77, 0x2a, 0x5e, 0x28, 0x86, 0x51, 0x03, 0x66, 0x8d, 0x53, 0xb8, 0x0c, 0x0c, 0x5c,
+    0x96, 0x0c, 0x5c, 0x73, 0xc9, 0x40, 0x68, 0x44, 0x9c, 0xa1, 0x43, 0xe7, 0xe9, 0x16, 0xdb, 0xd4,
+    0xd4, 0xdc, 0xaf, 0xe6, 0x6d, 0xe9, 0x89, 0x22, 0x68, 0x3a, 0x5b, 0x70, 0xf8, 0x7e, 0x2c, 0xe1,
+    0xad, 0xdc, 0x7b, 0xe6, 0xad, 0x21, 0xbd, 0x40, 0x4c, 0xd2, 0x5c, 0xc3, 0xc7, 0x5c, 0x90, 0x1b,
+    0x76, 0xad, 0xb5, 0x4a, 0x22, 0x85, 0x84, 0x89, 0x90, 0xeb, 0xb4, 0xd2, 0xdc, 0x60, 0xc7, 0x24,
+    0xe6, 0x2d, 0x61, 0x5a, 0x66, 0xaf, 0x9d, 0x89, 0x19, 0xc4, 0x72, 0x0c, 0x17, 0x51, 0xb5, 0x59,
+    0xae, 0xf3, 0xa8, 0x6d, 0x6b, 0x61, 0x9e, 0x94, 0xf1, 0x4c, 0x27, 0xf5, 0xd2, 0x09, 0x1b, 0x2b,
+    0x4e, 0x30, 0x6f, 0x03, 0x11, 0x86, 0xb9, 0xec, 0x65, 0x09, 0x18, 0x19, 0x32, 0x46, 0x82, 0x25,
+    0xec, 0x2d, 0x2b, 0xe9, 0x01, 0xcd, 0x53, 0xdc, 0x6a, 0x3c, 0x72, 0x03, 0x0e, 0x4f, 0xb1, 0x8c,
+    0x2d, 0x88, 0x67, 0xd1, 0xb5, 0x8c, 0x97, 0xf8, 0x42, 0x3e, 0x50, 0xd7, 0xf2, 0xb5, 0x36, 0x97,
+    0x8c, 0x69, 0x28, 0xe0, 0xef, 0x14, 0x7c, 0xab, 0x4e, 0x66, 0x37, 0xd4, 0x0b, 0x1b, 0x7a, 0x49,
+    0x16, 0x16, 0xda, 0x9e, 0x84, 0x84, 0x15, 0xac, 0xc8, 0x08, 0x57, 0x2f, 0xa1, 0x98, 0xca, 0xeb,
+    0xbe, 0x17, 0x4d, 0x3d, 0x52, 0x91, 0xf9, 0x06, 0xa5, 0xf6, 0x69, 0x87, 0x15, 0x85, 0xa7, 0x9d,
+    0xc3, 0xca, 0x19, 0x42, 0x08, 0x02, 0xca, 0x6a, 0x2a, 0xac, 0xc8, 0xc4, 0xe1, 0x86, 0x3c, 0x0a,
+    0x20, 0x53, 0xa3, 0x45, 0x2a, 0xbe, 0x05, 0xc2, 0xb4, 0xd6, 0x88, 0x63, 0x25, 0x84, 0x65, 0x37,
+    0x5f, 0x3e, 0xa1, 0x3e, 0x89, 0xae, 0x31, 0x48, 0x15, 0x51, 0x32, 0x51, 0x6f, 0xd4, 0x3c, 0xe1,
+    0x5d, 0xf8, 0x6b, 0xc8, 0xbf, 0x84, 0xe8, 0xc2, 0xc2, 0xb6, 0x56, 0x3d, 0x93, 0xc8, 0xa2, 0x68,
+    0xd8, 0x18, 0xc7, 0x01, 0x94, 0xf5, 0x61, 0x83, 0xec, 0x30, 0x2f, 0x49, 0xb8, 0x27, 0x09, 0x57,
+    0x91, 0x17, 0xda, 0x97, 0x8d, 0x29, 0x97, 0x4a, 0x20, 0x45, 0x48, 0xec, 0x76, 0x33, 0x43, 0xd5,
+    0xed, 0x66, 0xd6, 0x0e, 0x08, 0xe4, 0xb2, 0xe6, 0xc0, 0x25, 0x1e, 0x02, 0x31, 0xed, 0xed, 0x3c,
+    0x39, 0x78, 0xf2, 0xe2, 0xe9, 0x1e, 0xdb, 0x39, 0x3c, 0xd9, 0x6e, 0x12, 0x41, 0x93, 0x99, 0x08,
+    0xba, 0xd5, 0x50, 0x44, 0x67, 0xbb, 0xc6, 0xee, 0x6a, 0xef, 0xe5, 0xc9, 0x09, 0x6b, 0x34, 0xd8,
+    0x3b, 0xf6, 0xf2, 0xf8, 0x78, 0xdf, 0x3c, 0x1d, 0x1c, 0x1e, 0x1f, 0xe3, 0xa9, 0xbc, 0x2d, 0x8e,
+    0xfc, 0x50, 0xf8, 0x67, 0xdd, 0x2a, 0x1a, 0xce, 0xfe, 0x91, 0x65, 0x57, 0x7b, 0xdb, 0x28, 0xea,
+    0x48, 0x8b, 0x13, 0x49, 0x21, 0xcc, 0x71, 0x1c, 0x58, 0x87, 0x85, 0x1e, 0xfb, 0xe5, 0xaf, 0x7f,
+    0xce, 0x05, 0x34, 0xcb, 0x86, 0x31, 0x3f, 0xf4, 0xd2, 0xb4, 0x5b, 0xbd, 0x02, 0x28, 0xd5, 0xd5,
+    0xf5, 0x40, 0xa2, 0x46, 0x1a, 0x14, 0xbd, 0x84, 0x56, 0xfa, 0x13, 0xa5, 0x50, 0x0b, 0xd9, 0x22,
+    0xaa, 0xa8, 0xaa, 0x75, 0x53, 0x39, 0x0d, 0xc8, 0x98, 0xe9, 0x30, 0x5f, 0x2b, 0x55, 0x8e, 0x29,
+    0x80, 0x2a, 0xa3, 0x66, 0xb8, 0x13, 0x9f, 0x77, 0xab, 0x2e, 0x92, 0x09, 0x99, 0x42, 0xff, 0xb0,
+    0x29, 0x89, 0xc3, 0xf9, 0x10, 0x6c, 0x49, 0x2c, 0x22, 0x85, 0x9d, 0x6b, 0xed, 0xfa, 0x5a, 0x9b,
+    0x3d, 0x6c, 0xd7, 0xdb, 0x48, 0xb9, 0x76, 0xfd, 0x61, 0xbb, 0xda, 0xec, 0xe1, 0x38, 0xd3, 0x21,
+    0xfe, 0x1a, 0xfd, 0x99, 0x89, 0xda, 0xff, 0xdd, 0xea, 0x12, 0xe6, 0x11, 0x4a, 0xc8, 0xcb, 0x8e,
+    0x7b, 0x8b, 0xa9, 0xfd, 0x5b, 0x4d, 0xa5, 0x22, 0xfc, 0x6d, 0x8d, 0x2d, 0x45, 0x30, 0x53, 0x99,
+    0xd5, 0x26, 0xb9, 0x54, 0xa7, 0x27, 0xd3, 0xe9, 0x59, 0xd5, 0xf9, 0x69, 0xec, 0x4c, 0x13, 0xce,
+    0x83, 0x97, 0xe6, 0x7d, 0x2c, 0x22, 0xd8, 0x51, 0xa5, 0x99, 0x80, 0x34, 0xb6, 0x61, 0x9d, 0x17,
+    0x4e, 0xc0, 0x8f, 0xf4, 0x25, 0x11, 0x18, 0x08, 0x78, 0xd8, 0x3b, 0x3e, 0xda, 0xdb, 0xdb, 0xdd,
+    0x6e, 0x9a, 0x97, 0xeb, 0x94, 0xaa, 0x89, 0x8c, 0xb2, 0x50, 0xe6, 0xbe, 0xbb, 0xb6, 0x6e, 0x8c,
+    0x1f, 0x6f, 0xf5, 0x60, 0x78, 0xab, 0x07, 0x09, 0x9e, 0x7e, 0x5b, 0x0f, 0xde, 0x62, 0x8a, 0xbc,
+    0xc9, 0x94, 0xff, 0x4b, 0x0c, 0xaf, 0x7a, 0x95, 0x30, 0x8b, 0xbc, 0x95, 0x41, 0x21, 0x99, 0xa5,
+    0x30, 0x49, 0x60, 0x08, 0x94, 0xf3, 0x23, 0xbd, 0xb6, 0xdd, 0x34, 0x6b, 0x57, 0xf7, 0x65, 0x58,
+    0x47, 0xdb, 0x75, 0x1d, 0x67, 0x51, 0x31, 0x38, 0x77, 0x87, 0xb7, 0xd7, 0x1f, 0xad, 0xb7, 0xab,
+    0xbd, 0x5f, 0xbe, 0xff, 0x1b, 0x4b, 0x84, 0xf2, 0x47, 0xec, 0x3f, 0xef, 0xb3, 0xba, 0xbe, 0x96,
+    0xbf, 0xc5, 0x37, 0x37, 0x79, 0xc6, 0xaf, 0x30, 0x2d, 0x71, 0xf5, 0x91, 0x0d, 0x1b, 0xeb, 0x9e,
+    0xbb, 0xf1, 0xd0, 0x6c, 0xe8, 0x7b, 0x29, 0x67, 0x3a, 0xe9, 0x56, 0x77, 0xac, 0x9c, 0xe7, 0x18,
+    0x4d, 0x06, 0x49, 0xfb, 0xda, 0xe0, 0x52, 0xc6, 0xb6, 0xea, 0x99, 0xd4, 0x97, 0x22, 0x51, 0xbd,
+    0x4a, 0x08, 0xed, 0x32, 0xee, 0xc7, 0xc0, 0x29, 0xd6, 0x65, 0x61, 0x0c, 0xd4, 0x3c, 0x56, 0xb1,
+    0xf4, 0x86, 0xdc, 0x81, 0x61, 0xfb, 0x68, 0xe4, 0x56, 0x2d, 0x5b, 0xaf, 0xd9, 0xec, 0xdd, 0x3b,
+    0x74, 0x90, 0x08, 0x95, 0xe7, 0x10, 0x27, 0xb5, 0x25, 0x67, 0x14, 0xa7, 0x8a, 0x86, 0x68, 0xcc,
+    0x08, 0xb1, 0x3f, 0x19, 0xa3, 0xe5, 0xd3, 0xc6, 0x3d, 0xb2, 0x24, 0x52, 0x3b, 0xf3, 0xfd, 0xc0,
+    0xaa, 0x15, 0x90, 0x57, 0xb3, 0x1d, 0x11, 0x01, 0xbc, 0x4e, 0xf8, 0xb9, 0x82, 0xb6, 0x4c, 0x2e,
+    0x4d, 0x5f, 0x51, 0xaa, 0x98, 0xae, 0xb0, 0x14, 0x74, 0xb4, 0x14, 0xf4, 0xb1, 0x3a, 0xeb, 0xeb,
+    0xbf, 0xa1, 0xfe, 0x2b, 0xa9, 0xb3, 0x2d, 0x3a, 0xda, 0x5e, 0x04, 0x46, 0xfd, 0x7e, 0xc2, 0xe5,
+    0x1c, 0xbc, 0xd5, 0xea, 0x92, 0x76, 0x0c, 0x8d, 0xcf, 0x49, 0x80, 0x9b, 0x8b, 0xfc, 0x7c, 0x6f,
+    0xef, 0xe8, 0xc9, 0xc1, 0xfe, 0x17, 0x7b, 0x5f, 0x3d, 0x3f, 0x06, 0x7d, 0xcd, 0x75, 0x0d, 0x77,
+    0xca, 0xbf, 0x29, 0xb3, 0xa5, 0x22, 0xc0, 0xeb, 0x73, 0x4f, 0x8d, 0x9c, 0x41, 0x18, 0xc7, 0xd2,
+    0xd2, 0x8f, 0xa8, 0xf2, 0x20, 0x1e, 0x5b, 0x36, 0xfb, 0x8c, 0xb9, 0xe7, 0x0f, 0x9f, 0xe9, 0xff,
+    0xf6, 0x6c, 0x76, 0x9f, 0x86, 0x36, 0x00, 0xfb, 0x24, 0xd9, 0x51, 0x91, 0x95, 0x61, 0x6a, 0x9d,
+    0xd5, 0x06, 0x35, 0xfb, 0x32, 0xbd, 0x4f, 0xf4, 0xfe, 0x55, 0x7a, 0x48, 0xf4, 0xf0, 0x2a, 0x5d,
+    0x12, 0x5d, 0x12, 0x7d, 0x30, 0x89, 0x74, 0xd7, 0x67, 0x05, 0x83, 0x08, 0xea, 0xec, 0x8c, 0xcf,
+    0x6d, 0x0c, 0x38, 0xc6, 0x68, 0x1e, 0xc2, 0xe6, 0x9b, 0x7c, 0x2e, 0x02, 0xbb, 0x38, 0x1c, 0x72,
+    0x8c, 0xbc, 0x6d, 0x71, 0x9b, 0x75, 0x7b, 0x70, 0x2e, 0x77, 0x12, 0xc9, 0xa7, 0xe0, 0xdc, 0xe5,
+    0x03, 0x6f, 0x12, 0x2a, 0x0b, 0x8d, 0xd9, 0xf8, 0xfe, 0x0d, 0x14, 0x7c, 0x09, 0xd6, 0x56, 0x07,
+    0xd2, 0x1d, 0x5d, 0x00, 0x07, 0x22, 0x55, 0x0e, 0x66, 0x0b, 0xab, 0x66, 0xe6, 0xb0, 0x1a, 0x0d,
+    0x2d, 0xb9, 0x68, 0xea, 0xff, 0xbf, 0x4a, 0xb0, 0x7b, 0x49, 0xb0, 0xe4, 0xe3, 0x78, 0xca, 0x2f,
+    0xc9, 0x06, 0x07, 0x14, 0xee, 0x91, 0x20, 0x62, 0xe2, 0x48, 0x18, 0xab, 0xa6, 0x41, 0x80, 0x4b,
+    0x02, 0xfd, 0x5a, 0xdd, 0x9c, 0xc9, 0xbe, 0x9d, 0x75, 0x92, 0x80, 0x11, 0x16, 0x7e, 0x84, 0x2d,
+    0xe4, 0x1e, 0x34, 0xe7, 0x9c, 0x0b, 0x8a, 0xc8, 0x3e, 0xd1, 0x01, 0xdd, 0x96, 0x65, 0x0e, 0x96,
+    0x9d, 0x76, 0x8a, 0x03, 0x98, 0xe3, 0x38, 0x03, 0xd6, 0xc8, 0x1f, 0xfb, 0x1d, 0xd6, 0x6c, 0xb2,
+    0x16, 0xb3, 0x2e, 0x7e, 0xb8, 0xf8, 0xf9, 0xe2, 0xc7, 0x0f, 0x7f, 0xbc, 0xf8, 0xf1, 0xe2, 0xef,
+    0x76, 0x9d, 0x35, 0x88, 0xf4, 0xef, 0x8b, 0xf7, 0x17, 0xff, 0xc0, 0x3f, 0x22, 0xb8, 0xcc, 0xfa,
+    0xf0, 0xdd, 0x87, 0x3f, 0x5d, 0xfc, 0x74, 0xf1, 0xb3, 0x9d, 0x49, 0x1c, 0x2d, 0x25, 0xca, 0xa5,
+    0xc4, 0xb0, 0x2c, 0x11, 0xf2, 0xde, 0xe3, 0xf7, 0xa7, 0x5c, 0xe2, 0x0f, 0x17, 0xff, 0xfc, 0xf0,
+    0x7d, 0x46, 0x80, 0x44, 0x62, 0xf8, 0xf0, 0x97, 0x8b, 0x7f, 0xe1, 0x3d, 0x0f, 0xf7, 0x2d, 0x59,
+    0x51, 0x5b, 0x76, 0x2b, 0x94, 0xa2, 0x6e, 0x4e, 0x79, 0x28, 0xfd, 0x89, 0x94, 0x60, 0xcb, 0xcb,
+    0xea, 0x94, 0xe2, 0xf2, 0x78, 0xda, 0xbd, 0xfb, 0x76, 0xba, 0xb8, 0x37, 0xc2, 0xcf, 0x68, 0x71,
+    0x2f, 0xc5, 0x4f, 0xba, 0x38, 0xcd, 0x77, 0x44, 0xf1, 0x0c, 0x8c, 0xbb, 0x18, 0x67, 0x1d, 0x3c,
+    0x22, 0xd6, 0x15, 0x31, 0x60, 0xd6, 0x8a, 0x9c, 0x4f, 0xba, 0xdd, 0x52, 0xb1, 0x02, 0x3c, 0x68,
+    0x4f, 0xa3, 0x5c, 0xab, 0xbd, 0xee, 0x4a, 0x8d, 0x52, 0x76, 0x0f, 0x38, 0x20, 0xd4, 0x3a, 0x1d,
+    0x29, 0x95, 0x6c, 0x35, 0x9b, 0x77, 0xdf, 0x66, 0x28, 0xb1, 0xc0, 0x63, 0x59, 0x38, 0xec, 0x01,
+    0xe6, 0xc1, 0x22, 0x11, 0x2c, 0xee, 0x45, 0x78, 0xb8, 0x7f, 0x1f, 0x55, 0xbd, 0x38, 0xb5, 0x1d,
+    0x00, 0x13, 0x04, 0x58, 0x76, 0xb7, 0xf7, 0x76, 0x01, 0xab, 0xca, 0x68, 0x51, 0x16, 0x60, 0x56,
+    0x0a, 0xcc, 0x80, 0x69, 0x14, 0xfe, 0x45, 0x9d, 0xb5, 0x5d, 0x7b, 0x89, 0x29, 0x2f, 0x15, 0xd5,
+    0x4e, 0xc3, 0x94, 0xfc, 0x0d, 0x89, 0xa1, 0xdc, 0x1c, 0x3d, 0xf4, 0xf4, 0x6c, 0x25, 0x5c, 0xd2,
+    0xb4, 0x4f, 0x23, 0xa9, 0x71, 0x0d, 0x15, 0xf4, 0x4d, 0xa7, 0xe2, 0xfe, 0x28, 0x7e, 0xac, 0x60,
+    0xbf, 0x72, 0x17, 0xf7, 0x24, 0x7e, 0x33, 0xad, 0x38, 0x49, 0xc5, 0x51, 0x23, 0x1e, 0x59, 0x92,
+    0x74, 0x49, 0xe7, 0xeb, 0x34, 0x8e, 0x20, 0x2a, 0x23, 0x06, 0xc6, 0x80, 0xa5, 0x89, 0xb7, 0xea,
+    0x87, 0xd3, 0x03, 0x47, 0xe5, 0x91, 0x53, 0xb8, 0x84, 0x68, 0xf0, 0x40, 0xfd, 0xf9, 0x1c, 0x85,
+    0x17, 0x00, 0xd4, 0x02, 0x40, 0x7a, 0x5a, 0xb0, 0xe0, 0x99, 0x9c, 0x62, 0x38, 0x1f, 0x33, 0x8b,
+    0xba, 0xf2, 0x67, 0x19, 0x0f, 0x6b, 0x1a, 0xba, 0xed, 0xa8, 0xf8, 0x99, 0x38, 0xe7, 0x81, 0xd5,
+    0xb2, 0xd9, 0x16, 0xab, 0xb9, 0x8e, 0x5b, 0xbb, 0xa5, 0x0b, 0x94, 0xe6, 0xe8, 0xd5, 0x3e, 0x50,
+    0x39, 0xa5, 0xa9, 0x7a, 0x79, 0x70, 0x36, 0x4e, 0xf3, 0x01, 0xfb, 0xee, 0x5b, 0xd8, 0x98, 0xa6,
+    0x62, 0xc1, 0x82, 0x9d, 0x71, 0x3e, 0x6b, 0x83, 0x13, 0xd6, 0x2d, 0x3e, 0x45, 0x26, 0x2e, 0xe0,
+    0x8e, 0x3c, 0xdc, 0xc6, 0x21, 0xbf, 0x5e, 0x3d, 0xab, 0x15, 0x43, 0xfd, 0xc1, 0xfe, 0x8b, 0xcf,
+    0xd9, 0xee, 0xe1, 0xeb, 0x17, 0x35, 0x12, 0xdd, 0xa1, 0x64, 0xc0, 0xc1, 0xdd, 0x02, 0x4a, 0x8f,
+    0x0e, 0x0e, 0x4f, 0xbe, 0x3a, 0x3a, 0xdc, 0x7f, 0x71, 0x42, 0xdd, 0x64, 0xdd, 0x2d, 0x1a, 0x88,
+    0xbe, 0x64, 0x51, 0xe3, 0xd2, 0xfd, 0x7f, 0x8b, 0xbd, 0xf9, 0xb2, 0x9e, 0xb5, 0x76, 0xf3, 0x4c,
+    0x5d, 0x9b, 0x9e, 0xf2, 0x0e, 0x56, 0x74, 0xea, 0x5d, 0x19, 0xe3, 0xfa, 0x12, 0x94, 0x9b, 0xd1,
+    0xd1, 0xab, 0x83, 0x03, 0xd3, 0xae, 0xda, 0xe8, 0x7b, 0xfa, 0x6d, 0x7f, 0xf7, 0x20, 0xef, 0x60,
+    0x6d, 0xb7, 0xd4, 0x1c, 0xb0, 0x21, 0xc2, 0xed, 0xf0, 0x24, 0x97, 0x66, 0x2d, 0xbb, 0xc3, 0x4c,
+    0xe7, 0x34, 0x9f, 0xb1, 0xd7, 0xbc, 0x7f, 0x1c, 0xfb, 0x67, 0x5c, 0x59, 0xa7, 0xb3, 0x74, 0x35,
+    0xf5, 0x0a, 0x2b, 0x4e, 0x71, 0xc2, 0x19, 0xa0, 0x4c, 0x44, 0x9e, 0x9c, 0x9f, 0x60, 0xc4, 0x25,
+    0xaf, 0x60, 0x42, 0xf3, 0xe6, 0xfd, 0xc9, 0x60, 0xc0, 0x65, 0x6d, 0x59, 0x0f, 0x47, 0x93, 0x90,
+    0x52, 0x07, 0x96, 0xe1, 0x4e, 0x3b, 0xe3, 0x52, 0xdb, 0xae, 0xe4, 0x12, 0x48, 0x12, 0xc3, 0x90,
+    0xc7, 0x83, 0x30, 0x01, 0xa2, 0x25, 0xee, 0x34, 0x7a, 0x2c, 0xe1, 0x1a, 0x14, 0x0a, 0xa3, 0x9c,
+    0xc3, 0xa3, 0xbd, 0x17, 0x36, 0x93, 0x9c, 0x86, 0x5e, 0x6d, 0x44, 0x0a, 0x20, 0x06, 0x38, 0xd7,
+    0xb2, 0xca, 0xcd, 0xf4, 0x95, 0x61, 0xa6, 0xa4, 0x78, 0xe0, 0x85, 0x29, 0x7d, 0xf0, 0x29, 0x32,
+    0x5b, 0x8c, 0x39, 0xca, 0x85, 0xdd, 0x5c, 0xab, 0xa9, 0xa0, 0x0f, 0x70, 0x65, 0x81, 0x19, 0x20,
+    0x91, 0x22, 0x03, 0x61, 0x56, 0xa1, 0xe0, 0xde, 0xbd, 0x8c, 0x1f, 0x30, 0x95, 0x85, 0x45, 0xcf,
+    0x40, 0xab, 0xc4, 0x2c, 0x3a, 0xb6, 0x3e, 0xba, 0x65, 0xd2, 0x26, 0xe7, 0xd6, 0x47, 0x8a, 0xa3,
+    0x38, 0xe1, 0x11, 0x94, 0x26, 0x5a, 0x87, 0xa6, 0x8c, 0x79, 0x9a, 0x62, 0xc8, 0xd2, 0xed, 0x73,
+    0x9a, 0x59, 0x78, 0x83, 0x47, 0x83, 0x69, 0x16, 0x4a, 0xd8, 0xec, 0x7d, 0x81, 0x59, 0x19, 0x3b,
+    0x9c, 0x00, 0xcf, 0x19, 0xe4, 0x06, 0x53, 0x4a, 0xf6, 0x57, 0xe8, 0x66, 0x9b, 0x96, 0x6b, 0x6b,
+    0xff, 0xb6, 0x96, 0x2e, 0xcd, 0x8f, 0xfd, 0x2d, 0xe9, 0x2a, 0xb3, 0xb6, 0x8a, 0xb4, 0xf6, 0x81,
+    0x1a, 0x6a, 0x65, 0xb5, 0xf5, 0xc0, 0x5a, 0xab, 0x6b, 0x23, 0xe8, 0xbb, 0xcb, 0xd5, 0x64, 0x5d,
+    0x72, 0xae, 0xaf, 0x59, 0x1b, 0x05, 0x27, 0x50, 0x87, 0x59, 0x94, 0x29, 0xc2, 0xf4, 0x7a, 0xc1,
+    0xb6, 0x8d, 0x70, 0x3c, 0xde, 0xbf, 0xbf, 0x4c, 0xce, 0x18, 0xcb, 0x9b, 0xc0, 0x1c, 0x01, 0x4c,
+    0x21, 0xcb, 0x3a, 0x95, 0x64, 0x92, 0x8e, 0x2c, 0xaa, 0x22, 0x47, 0x57, 0x50, 0x9d, 0x65, 0x2a,
+    0x9e, 0x85, 0xb1, 0x47, 0x3a, 0x62, 0x1a, 0xbb, 0x72, 0x93, 0xec, 0x32, 0xbf, 0x29, 0xb3, 0xfa,
+    0x35, 0xfc, 0x6b, 0xee, 0x75, 0xfc, 0x54, 0x8a, 0x10, 0x7f, 0x1d, 0xff, 0xc6, 0x92, 0x7f, 0x41,
+    0x39, 0xa5, 0x03, 0xe5, 0x03, 0x6c, 0xf8, 0x32, 0xa1, 0x71, 0x2d, 0xe0, 0x9e, 0x2c, 0x92, 0x4b,
+    0x27, 0x1c, 0xc6, 0x16, 0x24, 0xdc, 0x09, 0x1e, 0xe3, 0x89, 0xb2, 0x2e, 0x17, 0x65, 0x8e, 0x21,
+    0x54, 0xfb, 0x8b, 0x65, 0xed, 0x6a, 0x8b, 0x50, 0x63, 0x75, 0x36, 0x25, 0xc7, 0xe0, 0xc9, 0xd1,
+    0xa4, 0x69, 0x16, 0x55, 0x22, 0x84, 0x3c, 0x1a, 0xaa, 0x11, 0xeb, 0x95, 0x81, 0xc7, 0x66, 0xb4,
+    0x92, 0x8e, 0xc4, 0x40, 0xe9, 0x5c, 0x5b, 0x4a, 0x0c, 0xa4, 0x37, 0xa3, 0x9b, 0x4c, 0x09, 0x05,
+    0xfc, 0xdb, 0x86, 0x81, 0x95, 0xeb, 0x4f, 0xad, 0xc8, 0x06, 0xea, 0xea, 0xbe, 0xa3, 0x3f, 0x14,
+    0xe9, 0x27, 0x3f, 0x14, 0xd8, 0xf2, 0x9a, 0xde, 0x3b, 0xa5, 0xb9, 0xc5, 0x77, 0xcc, 0x85, 0xbe,
+    0xc4, 0xf3, 0x3b, 0x4d, 0xc8, 0x99, 0x86, 0x7a, 0x05, 0x4a, 0xe9, 0x4b, 0x37, 0x90, 0xd6, 0xaa,
+    0xad, 0x05, 0xa4, 0x65, 0xe8, 0xa4, 0x4a, 0xc6, 0x67, 0xfc, 0x98, 0xee, 0x38, 0x04, 0x34, 0x77,
+    0xfc, 0x41, 0xb0, 0x19, 0xf8, 0x35, 0x5a, 0xea, 0xf3, 0xa1, 0x88, 0x8e, 0xd0, 0xca, 0x68, 0x76,
+    0x1c, 0x3a, 0x34, 0x85, 0x9c, 0xc4, 0x16, 0x02, 0x39, 0x42, 0xd7, 0x59, 0xd3, 0x34, 0x00, 0x39,
+    0xd1, 0x66, 0x65, 0x9a, 0x91, 0x68, 0x15, 0x67, 0x20, 0x1e, 0x8a, 0x99, 0xf6, 0xaf, 0xfe, 0x58,
+    0x58, 0x37, 0x5f, 0xa5, 0xb2, 0x4a, 0xbb, 0x6c, 0x83, 0x5e, 0xbb, 0xac, 0x5f, 0xc7, 0x04, 0x29,
+    0xbd, 0xe7, 0x51, 0x7f, 0x99, 0xd6, 0x99, 0x58, 0x41, 0x92, 0x73, 0x1a, 0xde, 0x90, 0xc0, 0x33,
+    0x58, 0x51, 0x8a, 0x4f, 0x6e, 0x02, 0x8d, 0x1b, 0xda, 0x40, 0xe0, 0x8b, 0xee, 0xcd, 0x63, 0xef,
+    0xdc, 0x6a, 0xb4, 0xea, 0xd9, 0x8b, 0x88, 0x2c, 0x3c, 0x4f, 0xc1, 0xa0, 0xcd, 0xb3, 0xe9, 0x96,
+    0xa1, 0xd9, 0x11, 0x7d, 0x34, 0xdc, 0xe2, 0x98, 0xe7, 0x75, 0x36, 0xa7, 0xee, 0x5a, 0xf8, 0x42,
+    0x13, 0x4c, 0x7b, 0x2a, 0x9f, 0x9b, 0x1a, 0x0b, 0x76, 0xac, 0xd6, 0xd0, 0x46, 0x9b, 0x32, 0x1d,
+    0x1e, 0x36, 0x57, 0x54, 0x8d, 0xa9, 0x05, 0x53, 0x5e, 0x38, 0x05, 0x93, 0xb9, 0x97, 0xae, 0x32,
+    0xe5, 0xd5, 0xd2, 0x46, 0x0a, 0x23, 0x0a, 0xb5, 0xec, 0x2e, 0x4a, 0x4c, 0x1f, 0xcf, 0x2b, 0x7d,
+    0x0d, 0xbd, 0xd4, 0x6c, 0x4f, 0x83, 0x0c, 0x44, 0x30, 0xf0, 0x5c, 0xc2, 0x15, 0x1a, 0x2d, 0x25,
+    0xff, 0x66, 0xc2, 0x53, 0xf5, 0x24, 0x12, 0x63, 0x7d, 0xbd, 0x7c, 0x26, 0x71, 0xb5, 0xb4, 0xf2,
+    0xcc, 0xd6, 0xf9, 0x7e, 0xb5, 0xe9, 0xfd, 0x0f, 0xdb, 0xca, 0xf7, 0x29, 0xfa, 0x22, 0x47, 0xa3,
+    0x13, 0xdd, 0x7c, 0x39, 0xb5, 0xc9, 0x44, 0xc6, 0xe3, 0x44, 0x59, 0x55, 0x5c, 0x81, 0x69, 0x56,
+    0xa7, 0x11, 0xfe, 0xc3, 0x77, 0x17, 0xef, 0xb7, 0x70, 0x1b, 0xcb, 0x7a, 0xa5, 0xae, 0x49, 0x0b,
+    0xdc, 0xd8, 0x58, 0xba, 0x2e, 0x83, 0xd0, 0x59, 0xbd, 0x33, 0xa7, 0x97, 0xef, 0xcc, 0x75, 0x62,
+    0xb2, 0x0d, 0x97, 0xbe, 0x2f, 0x4b, 0x0e, 0xc8, 0x09, 0x2c, 0xfd, 0xed, 0x57, 0x7f, 0x9d, 0xcc,
+    0x2e, 0xe2, 0xdb, 0xcd, 0xec, 0xbb, 0x64, 0x53, 0xff, 0xdf, 0xac, 0xff, 0x02, 0x10, 0x75, 0xf3,
+    0xce, 0xdd, 0x1a, 0x00, 0x00,
+};
@@ -0,0 +1,197 @@
+#pragma once
+#include <math.h>
+
+#include "BalancePID_Manager.h"
+#include "SteeringPID_Manager.h"
+#include "ControlPage_Command.h"
+#include "BinaryLog_Format.h"
+#include "RobotConfig_Format.h"
+
+
+
+// =========================================================
+//  Ядро такту керування: аварійна зупинка, команда, deadman,
+//  поворот, баланс -> швидкості коліс
+//  Залежить лише від BalanceController і SteeringController:
+//  ні MPU, ні моторів, ні millis(), ні веб-сервера. Той самий код
+//  виконує RobotController на платі й tools/replay.cpp на Linux
+// =========================================================
+
+// === Входи одного такту ===
+// З датчиків (RobotController::run) або з запису бінарного логу (fromSample)
+struct ControlInputs {
+    unsigned long  now;
+    float          pitch;
+    float          gyroZ;
+    long           leftPos;       // кроки, як getPosition() моторів
+    long           rightPos;
+    ControlCommand cmd;
+    bool           linkAlive;
+};
+
+// === Результат такту ===
+struct ControlOutputs {
+    ControlCommand cmd;           // після deadman
+    float targetSpeed;
+    float steerOffset;
+    float baseSpeed;
+    float leftSpeed;              // кр/с зі знаком, до мотора
+    float rightSpeed;
+    bool  fell;                   // у цьому такті: робот щойно впав
+    bool  linkDropped;            // у цьому такті: зв'язок щойно втрачено
+};
+
+
+class ControlCore {
+
+public:
+
+    BalanceController&  balanceController;
+    SteeringController& steeringController;
+
+    static constexpr unsigned long PID_INTERVAL_MS = 10;
+
+    // === З RobotConfig (applyConfig) ===
+    float maxSpeed  = 50000.0f;
+    float maxSteer  = 2000.0f;
+    float fallAngle = 40.0f;
+
+    // === Deadman ===
+    float linkLossDecel = 25000.0f;         // кр/с², плавне гальмування до 0
+
+    bool  fallen = false;
+    bool  linkLost = true;                  // до першої команди зв'язку ще немає
+    float commandedSpeed = 0.0f;            // targetSpeed після рампи
+
+
+public:
+
+    ControlCore(BalanceController& balanceController, SteeringController& steeringController)
+        : balanceController(balanceController), steeringController(steeringController)
+    {}
+
+    // Коефіцієнти і межі. Інтегратори не скидаються —
+    // можна викликати під час балансування
+    void applyConfig(const RobotConfig& c) {
+        balanceController.setInnerGains(c.innerKp, c.innerKi, c.innerKd);
+        balanceController.setOuterPID(c.outerKp);
+        balanceController.setBalanceOffset(c.balanceOffset);
+
+        steeringController.setGains(c.steerKp, c.steerKi);
+        steeringController.setGyroWeight(c.gyroWeight);
+        steeringController.setGyroSign(c.gyroSign);
+        steeringController.setGeometry(c.wheelDiameterMm, c.trackWidthMm, c.stepsPerRev);
+
+        maxSpeed  = c.maxSpeed;
+        maxSteer  = c.maxSteer;
+        fallAngle = c.fallAngle;
+        steeringController.setMaxSteer(maxSteer);
+    }
+
+    void begin(long leftPos, long rightPos, unsigned long now) {
+        balanceController.begin(now);
+        balanceController.setEnabled(true);
+
+        steeringController.setMaxSteer(maxSteer);
+        steeringController.begin(leftPos, rightPos, now);
+        steeringController.setEnabled(true);
+    }
+
+
+    // Детермінований при тих самих входах
+    void step(const ControlInputs& in, ControlOutputs& out) {
+
+        // --- Аварійна зупинка ---
+        bool wasFallen = fallen;
+        if (fabsf(in.pitch) > fallAngle) {
+            balanceController.emergencyStop();
+            steeringController.setEnabled(false);
+            fallen = true;
+        }
+
+        else {
+            balanceController.setEnabled(true);
+            fallen = false;
+        }
+        out.fell = fallen && !wasFallen;
+
+
+        // --- Команда від веб-інтерфейсу ---
+        ControlCommand cmd = in.cmd;
+
+        float targetSpeed = 0.0f;
+        switch (cmd.direction) {
+            case FORWARD:
+
+            case FORWARD_LEFT:
+
+            case FORWARD_RIGHT:
+                targetSpeed =  (cmd.speed / 255.0f) * maxSpeed;
+                break;
+
+            case BACKWARD:
+
+            case BACKWARD_LEFT:
+
+            case BACKWARD_RIGHT:
+                targetSpeed = -(cmd.speed / 255.0f) * maxSpeed;
+                break;
+            default:
+
+                targetSpeed =  0.0f;
+                break;
+        }
+
+        // --- Deadman: без keep-alive гальмуємо по профілю, а не обриваємо ---
+        out.linkDropped = !in.linkAlive && !linkLost;
+        linkLost = !in.linkAlive;
+
+        if (linkLost) {
+            float step = linkLossDecel * (PID_INTERVAL_MS / 1000.0f);
+            if      (commandedSpeed >  step) commandedSpeed -= step;
+            else if (commandedSpeed < -step) commandedSpeed += step;
+            else                             commandedSpeed  = 0.0f;
+            targetSpeed = commandedSpeed;
+            cmd.steer   = 50;
+        } else {
+            // Рампа починається з того, що реально виконує баланс
+            float limit = balanceController.getMaxSpeed();
+            commandedSpeed = constrain(targetSpeed, -limit, limit);
+        }
+
+        // --- Поворот: замкнений контур по gyroZ ---
+        steeringController.setSteer(cmd.steer);
+        steeringController.update(in.gyroZ, in.leftPos, in.rightPos, in.now);
+        float steerOffset = steeringController.getSteerOffset();
+
+        // --- PID ---
+        balanceController.setTargetSpeed(targetSpeed);
+        balanceController.update(in.pitch, in.now);
+        float baseSpeed = balanceController.getBaseSpeed();
+
+        // --- Диференційний поворот ---
+        out.cmd         = cmd;
+        out.targetSpeed = targetSpeed;
+        out.steerOffset = steerOffset;
+        out.baseSpeed   = baseSpeed;
+        out.leftSpeed   = fallen ? 0.0f : constrain(baseSpeed + steerOffset, -maxSpeed, maxSpeed);
+        out.rightSpeed  = fallen ? 0.0f : constrain(baseSpeed - steerOffset, -maxSpeed, maxSpeed);
+    }
+
+
+    // Входи такту з запису .bblog (чорна скринька, /log, botlog from-text)
+    static ControlInputs fromSample(const BinaryLog_Sample& s) {
+        ControlInputs in;
+        in.now           = (unsigned long)s.v[BLOG_TIME_MS];
+        in.pitch         = s.get(BLOG_PITCH);
+        in.gyroZ         = s.get(BLOG_GYRO_Z);
+        in.leftPos       = s.v[BLOG_LEFT_POS];
+        in.rightPos      = s.v[BLOG_RIGHT_POS];
+        in.cmd.direction = (DirectionVector)s.v[BLOG_CMD_DIR];
+        in.cmd.speed     = (uint8_t)s.v[BLOG_CMD_SPEED];
+        in.cmd.steer     = (uint8_t)s.v[BLOG_CMD_STEER];
+        in.linkAlive     = !(s.v[BLOG_FLAGS] & TELEM_LINK_LOST);
+        return in;
+    }
+
+};
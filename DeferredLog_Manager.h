@@ -0,0 +1,171 @@
+#pragma once
+#include <Arduino.h>
+#include <stdarg.h>
+
+#include "Mpsc_RingBuffer.h"
+
+
+
+// =========================================================
+//  Відкладене логування
+//  LOG_W("Робот впав, pitch=%.1f", pitch);
+//
+//  Виклик лише форматує рядок у комірку кільцевого буфера (фіксована
+//  вартість, без очікування UART); у Serial пише фонове завдання.
+//  Фільтр рівня — під час виконання, обмеження частоти — окремо для
+//  кожного місця виклику (LOG_RATE_PER_SEC повідомлень за секунду)
+// =========================================================
+
+enum LogLevel : uint8_t {
+    LOG_LEVEL_ERROR = 0,
+    LOG_LEVEL_WARN  = 1,
+    LOG_LEVEL_INFO  = 2,
+    LOG_LEVEL_DEBUG = 3,
+};
+
+// Стан обмежувача для одного місця виклику
+struct LogRateLimit {
+    uint32_t windowStartMs = 0;
+    uint16_t count         = 0;
+    uint16_t suppressed    = 0;
+};
+
+struct LogMessage {
+    uint32_t timeMs;
+    uint8_t  level;
+    uint8_t  len;
+    uint16_t suppressed;       // скільки пропущено цим місцем виклику перед цим
+    char     text[116];
+};
+
+class DeferredLog_Manager {
+
+public:
+
+    static constexpr size_t   RING_SIZE        = 32;
+    static constexpr uint16_t LOG_RATE_PER_SEC = 5;
+    static constexpr uint32_t DRAIN_PERIOD_MS  = 10;
+
+private:
+
+    Mpsc_RingBuffer<LogMessage, RING_SIZE> ring;
+    HardwareSerial* port;
+
+    volatile uint8_t level;
+
+    std::atomic<uint32_t> dropped;      // буфер повний
+    std::atomic<uint32_t> suppressed;   // відсічено обмежувачем частоти
+    std::atomic<uint32_t> written;
+
+    static void drainTask(void* arg) {
+        DeferredLog_Manager* self = static_cast<DeferredLog_Manager*>(arg);
+        uint32_t reportedDropped = 0;
+        LogMessage msg;
+        char line[160];
+        for (;;) {
+            while (self->ring.pop(msg)) {
+                static const char LEVELS[] = "EWID";
+                int n;
+                if (msg.suppressed) {
+                    n = snprintf(line, sizeof(line), "[%8lu] %c %.*s (+%u suppressed)\n",
+                                 (unsigned long)msg.timeMs, LEVELS[msg.level],
+                                 msg.len, msg.text, (unsigned)msg.suppressed);
+                } else {
+                    n = snprintf(line, sizeof(line), "[%8lu] %c %.*s\n",
+                                 (unsigned long)msg.timeMs, LEVELS[msg.level], msg.len, msg.text);
+                }
+                self->writeLine(line, min((size_t)n, sizeof(line) - 1));
+            }
+
+            uint32_t d = self->dropped.load(std::memory_order_relaxed);
+            if (d != reportedDropped) {
+                int n = snprintf(line, sizeof(line), "[%8lu] W log: %lu messages dropped\n",
+                                 millis(), (unsigned long)(d - reportedDropped));
+                self->writeLine(line, n);
+                reportedDropped = d;
+            }
+            vTaskDelay(pdMS_TO_TICKS(DRAIN_PERIOD_MS));
+        }
+    }
+
+    // Чекаємо місця в TX-буфері тут, у фоновому завданні
+    void writeLine(const char* line, size_t len) {
+        while (port->availableForWrite() < (int)len) {
+            vTaskDelay(1);
+        }
+        port->write((const uint8_t*)line, len);
+        written.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+
+    DeferredLog_Manager()
+        : port(nullptr), level(LOG_LEVEL_INFO)
+        , dropped(0), suppressed(0), written(0)
+    {}
+
+    // Після Serial.begin(); до цього повідомлення лише накопичуються
+    void begin(HardwareSerial& serial) {
+        port = &serial;
+        xTaskCreatePinnedToCore(drainTask, "log", 3072, this, 1, nullptr, 0);
+    }
+
+    void setLevel(LogLevel lvl)       { level = lvl; }
+    bool enabled(LogLevel lvl) const  { return lvl <= level; }
+
+    void write(LogLevel lvl, LogRateLimit& rl, const char* fmt, ...) __attribute__((format(printf, 4, 5))) {
+        if (!enabled(lvl)) return;
+
+        uint32_t now = millis();
+        if (now - rl.windowStartMs >= 1000) {
+            rl.windowStartMs = now;
+            rl.count = 0;
+        }
+        if (rl.count >= LOG_RATE_PER_SEC) {
+            rl.suppressed++;
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        rl.count++;
+
+        uint32_t ticket;
+        LogMessage* msg = ring.reserve(ticket);
+        if (!msg) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(msg->text, sizeof(msg->text), fmt, args);
+        va_end(args);
+
+        msg->timeMs     = now;
+        msg->level      = lvl;
+        msg->len        = (n < 0) ? 0 : min((size_t)n, sizeof(msg->text) - 1);
+        msg->suppressed = rl.suppressed;
+        rl.suppressed   = 0;
+        ring.commit(ticket);
+    }
+
+    uint32_t getDropped()    const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t getSuppressed() const { return suppressed.load(std::memory_order_relaxed); }
+    uint32_t getWritten()    const { return written.load(std::memory_order_relaxed); }
+
+};
+
+// Один екземпляр на прошивку — доступний з будь-якого заголовка
+inline DeferredLog_Manager& Log() {
+    static DeferredLog_Manager instance;
+    return instance;
+}
+
+#define LOG_AT(lvl, ...) do {                                   \
+        static LogRateLimit _logRate;                           \
+        Log().write((lvl), _logRate, __VA_ARGS__);              \
+    } while (0)
+
+#define LOG_E(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_W(...) LOG_AT(LOG_LEVEL_WARN,  __VA_ARGS__)
+#define LOG_I(...) LOG_AT(LOG_LEVEL_INFO,  __VA_ARGS__)
+#define LOG_D(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
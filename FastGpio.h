@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+#include <soc/gpio_struct.h>
+
+
+
+// =========================================================
+//  Вивід GPIO прямими записами в регістри set/clear (ESP32)
+//  Пін відомий під час компіляції, тож фронт — один запис
+//  без пошуку по таблиці пінів, як у digitalWrite()
+//
+//  Піни 0..31  — GPIO.out_w1ts / out_w1tc
+//  Піни 32..39 — GPIO.out1_w1ts / out1_w1tc
+// =========================================================
+
+namespace FastGpio {
+
+    // Маски одного запису для кожного банку
+    struct Masks {
+        uint32_t low;     // піни 0..31
+        uint32_t high;    // піни 32..39
+    };
+
+    inline void set(Masks m) {
+        if (m.low)  GPIO.out_w1ts = m.low;
+        if (m.high) GPIO.out1_w1ts.val = m.high;
+    }
+
+    inline void clear(Masks m) {
+        if (m.low)  GPIO.out_w1tc = m.low;
+        if (m.high) GPIO.out1_w1tc.val = m.high;
+    }
+
+    inline Masks merge(Masks a, Masks b) {
+        return Masks{ a.low | b.low, a.high | b.high };
+    }
+
+}
+
+
+template <uint8_t PIN>
+struct FastPin {
+
+    static_assert(PIN < 34, "GPIO 34..39 are input-only on ESP32");
+
+    static constexpr uint32_t LOW_MASK  = PIN < 32 ? (1u << (PIN & 31)) : 0;
+    static constexpr uint32_t HIGH_MASK = PIN < 32 ? 0 : (1u << (PIN & 31));
+
+    static FastGpio::Masks masks() { return FastGpio::Masks{ LOW_MASK, HIGH_MASK }; }
+
+    static void output() { pinMode(PIN, OUTPUT); }
+
+    static void high() {
+        if (PIN < 32) GPIO.out_w1ts = LOW_MASK;
+        else          GPIO.out1_w1ts.val = HIGH_MASK;
+    }
+
+    static void low() {
+        if (PIN < 32) GPIO.out_w1tc = LOW_MASK;
+        else          GPIO.out1_w1tc.val = HIGH_MASK;
+    }
+
+    static void write(bool level) {
+        if (level) high();
+        else       low();
+    }
+
+};
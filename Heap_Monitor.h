@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+
+
+
+// =========================================================
+//  Телеметрія купи
+//  freeHeap / largestBlock — поточні значення
+//  minFreeHeap             — мінімум з моменту старту (веде ESP-IDF)
+//  minLargestBlock         — мінімум найбільшого блоку серед вибірок
+//  Різниця між вільною пам'яттю і найбільшим блоком — міра фрагментації
+// =========================================================
+
+class Heap_Monitor {
+
+private:
+
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+    uint32_t minFreeHeap;
+    uint32_t minLargestBlock;
+    uint32_t samples;
+
+public:
+
+    Heap_Monitor()
+        : freeHeap(0), largestBlock(0), minFreeHeap(0)
+        , minLargestBlock(UINT32_MAX), samples(0)
+    {}
+
+    // heap_caps_get_largest_free_block обходить купу — не для контуру керування
+    void sample() {
+        freeHeap     = ESP.getFreeHeap();
+        largestBlock = ESP.getMaxAllocHeap();
+        minFreeHeap  = ESP.getMinFreeHeap();
+        if (largestBlock < minLargestBlock) minLargestBlock = largestBlock;
+        samples++;
+    }
+
+    // Фрагментація, %: 0 — уся вільна пам'ять одним блоком
+    uint8_t fragmentation() const {
+        if (freeHeap == 0) return 0;
+        return (uint8_t)(100 - (uint64_t)largestBlock * 100 / freeHeap);
+    }
+
+    size_t formatJson(char* buf, size_t len) const {
+        int n = snprintf(buf, len,
+            "{\"free\":%lu,\"largest\":%lu,\"minFree\":%lu,\"minLargest\":%lu,"
+            "\"fragmentation\":%u,\"samples\":%lu}",
+            (unsigned long)freeHeap, (unsigned long)largestBlock,
+            (unsigned long)minFreeHeap,
+            (unsigned long)(samples ? minLargestBlock : 0),
+            (unsigned)fragmentation(), (unsigned long)samples);
+        return n < 0 ? 0 : (size_t)n;
+    }
+
+    uint32_t getFreeHeap()        const { return freeHeap; }
+    uint32_t getLargestBlock()    const { return largestBlock; }
+    uint32_t getMinFreeHeap()     const { return minFreeHeap; }
+    uint32_t getMinLargestBlock() const { return minLargestBlock; }
+
+};
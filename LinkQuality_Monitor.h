@@ -0,0 +1,226 @@
+#pragma once
+#include <Arduino.h>
+
+
+
+// =========================================================
+//  Гістограма з фіксованими межами кошиків
+//  EDGES — верхні межі (не включно), останній кошик — "все інше"
+// =========================================================
+
+template <size_t N>
+struct FixedHistogram {
+
+    const int32_t* edges;      // N-1 меж
+    uint32_t counts[N];
+    uint32_t total;
+    int32_t  minValue;
+    int32_t  maxValue;
+    int64_t  sum;
+
+    explicit FixedHistogram(const int32_t* edges) : edges(edges) { reset(); }
+
+    void reset() {
+        memset(counts, 0, sizeof(counts));
+        total = 0;
+        minValue = INT32_MAX;
+        maxValue = INT32_MIN;
+        sum = 0;
+    }
+
+    void add(int32_t value) {
+        size_t i = 0;
+        while (i < N - 1 && value >= edges[i]) i++;
+        counts[i]++;
+        total++;
+        sum += value;
+        if (value < minValue) minValue = value;
+        if (value > maxValue) maxValue = value;
+    }
+
+    int32_t mean() const { return total ? (int32_t)(sum / total) : 0; }
+
+    void printJson(Print& out) const {
+        out.print("{\"n\":");    out.print(total);
+        out.print(",\"min\":");  out.print(total ? minValue : 0);
+        out.print(",\"max\":");  out.print(total ? maxValue : 0);
+        out.print(",\"mean\":"); out.print(mean());
+        out.print(",\"edges\":[");
+        for (size_t i = 0; i < N - 1; i++) {
+            if (i) out.print(",");
+            out.print(edges[i]);
+        }
+        out.print("],\"counts\":[");
+        for (size_t i = 0; i < N; i++) {
+            if (i) out.print(",");
+            out.print(counts[i]);
+        }
+        out.print("]}");
+    }
+};
+
+
+// =========================================================
+//  Якість зв'язку з веб-сторінкою
+//  - інтервали між командами та втрати (по розривах seq) для кожного клієнта;
+//    seq рахується в межах сеансу sid — кожне завантаження сторінки новий
+//  - RTT, виміряний сторінкою через /echo
+//  - RSSI з NetworkConnection_Manager
+//  Оновлюється лише з обробників AsyncWebServer, контур керування не чіпає
+// =========================================================
+
+class LinkQuality_Monitor {
+
+public:
+
+    static constexpr size_t MAX_CLIENTS = 4;
+
+    static constexpr size_t ARRIVAL_BUCKETS = 10;
+    static constexpr size_t RTT_BUCKETS     = 10;
+    static constexpr size_t RSSI_BUCKETS    = 8;
+
+    struct ClientStats {
+        uint32_t      ip;
+        uint32_t      sid;            // сеанс сторінки; 0 — без сеансу
+        uint32_t      sessions;
+        uint32_t      lastSeq;
+        unsigned long lastArrivalMs;
+        uint32_t      received;
+        uint32_t      lost;
+        uint32_t      reordered;
+        FixedHistogram<ARRIVAL_BUCKETS> interArrivalMs;
+
+        ClientStats() : interArrivalMs(arrivalEdges()) { clear(0); }
+
+        void clear(uint32_t newIp) {
+            ip = newIp;
+            sid = 0;
+            sessions = 0;
+            lastSeq = 0;
+            lastArrivalMs = 0;
+            received = 0;
+            lost = 0;
+            reordered = 0;
+            interArrivalMs.reset();
+        }
+    };
+
+private:
+
+    ClientStats clients[MAX_CLIENTS];
+
+    FixedHistogram<RTT_BUCKETS>  rttMs;
+    FixedHistogram<RSSI_BUCKETS> rssiDbm;
+    int8_t lastRssi;
+
+    static const int32_t* arrivalEdges() {
+        static const int32_t e[ARRIVAL_BUCKETS - 1] = { 25, 50, 100, 150, 200, 300, 500, 1000, 2000 };
+        return e;
+    }
+    static const int32_t* rttEdges() {
+        static const int32_t e[RTT_BUCKETS - 1] = { 5, 10, 20, 30, 50, 75, 100, 200, 500 };
+        return e;
+    }
+    static const int32_t* rssiEdges() {
+        static const int32_t e[RSSI_BUCKETS - 1] = { -90, -80, -75, -70, -65, -60, -50 };
+        return e;
+    }
+
+    // Знаходимо слот клієнта або займаємо найдавніший
+    ClientStats& slotFor(uint32_t ip) {
+        ClientStats* oldest = &clients[0];
+        for (size_t i = 0; i < MAX_CLIENTS; i++) {
+            if (clients[i].ip == ip) return clients[i];
+            if (clients[i].lastArrivalMs < oldest->lastArrivalMs) oldest = &clients[i];
+        }
+        oldest->clear(ip);
+        return *oldest;
+    }
+
+public:
+
+    LinkQuality_Monitor()
+        : rttMs(rttEdges()), rssiDbm(rssiEdges()), lastRssi(0)
+    {}
+
+    // seq = 0 — клієнт без нумерації, рахуємо лише інтервали.
+    // Новий sid (перезавантаження сторінки) — seq починається з 1 знову
+    void onCommand(uint32_t ip, uint32_t sid, uint32_t seq, unsigned long nowMs) {
+        ClientStats& c = slotFor(ip);
+
+        // Інтервал — від попереднього пакета, навіть переставленого
+        if (c.received > 0) {
+            c.interArrivalMs.add((int32_t)(nowMs - c.lastArrivalMs));
+        }
+        c.lastArrivalMs = nowMs;
+
+        if (sid != 0 && sid != c.sid) {
+            c.sid = sid;
+            c.sessions++;
+            c.lastSeq = 0;
+        }
+
+        if (seq != 0 && c.lastSeq != 0) {
+            if (seq > c.lastSeq) {
+                c.lost += seq - c.lastSeq - 1;
+            } else if (sid == 0 && c.lastSeq - seq > 1000) {
+                // Стара сторінка без sid: великий відкат — теж перезавантаження
+            } else {
+                c.reordered++;
+                return;
+            }
+        }
+
+        if (seq != 0) c.lastSeq = seq;
+        c.received++;
+    }
+
+    void onRtt(int32_t ms)     { if (ms >= 0) rttMs.add(ms); }
+    void onRssi(int8_t dbm)    { if (dbm != 0) { lastRssi = dbm; rssiDbm.add(dbm); } }
+
+    int8_t getLastRssi() const { return lastRssi; }
+
+    const ClientStats* findClient(uint32_t ip) const {
+        for (size_t i = 0; i < MAX_CLIENTS; i++) {
+            if (clients[i].ip == ip && clients[i].received > 0) return &clients[i];
+        }
+        return nullptr;
+    }
+
+    void reset() {
+        for (size_t i = 0; i < MAX_CLIENTS; i++) clients[i].clear(0);
+        rttMs.reset();
+        rssiDbm.reset();
+    }
+
+    void printJson(Print& out) const {
+        out.print("{\"rssi\":");
+        out.print(lastRssi);
+        out.print(",\"rssiHist\":");
+        rssiDbm.printJson(out);
+        out.print(",\"rttHist\":");
+        rttMs.printJson(out);
+        out.print(",\"clients\":[");
+        bool first = true;
+        for (size_t i = 0; i < MAX_CLIENTS; i++) {
+            const ClientStats& c = clients[i];
+            if (c.received == 0) continue;
+            if (!first) out.print(",");
+            first = false;
+            out.print("{\"ip\":\"");
+            out.print(c.ip & 0xFF);         out.print(".");
+            out.print((c.ip >> 8) & 0xFF);  out.print(".");
+            out.print((c.ip >> 16) & 0xFF); out.print(".");
+            out.print((c.ip >> 24) & 0xFF);
+            out.print("\",\"received\":"); out.print(c.received);
+            out.print(",\"lost\":");       out.print(c.lost);
+            out.print(",\"reordered\":");  out.print(c.reordered);
+            out.print(",\"sessions\":");   out.print(c.sessions);
+            out.print(",\"interArrival\":");
+            c.interArrivalMs.printJson(out);
+            out.print("}");
+        }
+        out.print("]}");
+    }
+
+};
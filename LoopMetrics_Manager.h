@@ -0,0 +1,262 @@
+#pragma once
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+
+#include "DeferredLog_Manager.h"
+#include "WebRequest_Helpers.h"
+#include "SteperMotor_Controller.h"   // також визначає ROBOT_METRICS за замовчуванням
+
+
+
+// =========================================================
+//  Вимірювання часу етапів RobotController::run за лічильником тактів CPU
+//  ROBOT_METRICS 0 — макроси зникають, /metrics не реєструється
+//
+//  METRICS_MARK(t);                       — запам'ятати лічильник у t
+//  METRICS_RECORD(metrics, METRIC_MPU, t); — додати (зараз - t) до гістограми
+//  METRICS_RECORD_US(metrics, METRIC_PERIOD, us) — готове значення в мкс
+// =========================================================
+
+enum MetricStage : uint8_t {
+    METRIC_STEPS = 0,    // генерація кроків (кожна ітерація loop())
+    METRIC_TICK,         // такт керування (кожні 10 мс)
+    METRIC_PERIOD,       // інтервал між тактами
+    METRIC_MPU,          // mpu6050.update()
+    METRIC_PID,          // баланс + поворот
+    METRIC_MOTORS,       // setDirection / setSpeed
+    METRIC_RECORD,       // телеметрія, чорна скринька, лог
+
+    METRIC_STAGE_COUNT
+};
+
+#if ROBOT_METRICS
+
+#define METRICS_MARK(var)                uint32_t var = ESP.getCycleCount()
+#define METRICS_RECORD(mgr, stage, var)  (mgr).record((stage), ESP.getCycleCount() - (var))
+#define METRICS_RECORD_US(mgr, stage, us) (mgr).recordMicros((stage), (us))
+
+
+// Лог-лінійна гістограма тактів: 2 кошики на октаву, від 2^4 до 2^27
+struct CycleHistogram {
+
+    static constexpr uint8_t MIN_BIT = 4;
+    static constexpr uint8_t MAX_BIT = 27;
+    static constexpr size_t  BUCKETS = (MAX_BIT - MIN_BIT) * 2 + 1;
+
+    uint32_t counts[BUCKETS];
+    uint32_t total;
+    uint64_t sum;
+    uint32_t maxCycles;
+
+    void reset() { memset(this, 0, sizeof(*this)); }
+
+    static size_t bucketOf(uint32_t cycles) {
+        if (cycles < (1u << MIN_BIT)) return 0;
+        uint8_t msb = 31 - __builtin_clz(cycles);
+        if (msb >= MAX_BIT) return BUCKETS - 1;
+        uint8_t half = (cycles >> (msb - 1)) & 1;
+        return (msb - MIN_BIT) * 2 + half + 1;
+    }
+
+    // Верхня межа кошика в тактах
+    static uint32_t upperEdge(size_t b) {
+        if (b == 0) return 1u << MIN_BIT;
+        if (b >= BUCKETS - 1) return UINT32_MAX;
+        uint8_t msb = MIN_BIT + (b - 1) / 2;
+        return ((b - 1) & 1) ? (1u << (msb + 1)) : (3u << (msb - 1));
+    }
+
+    void add(uint32_t cycles) {
+        counts[bucketOf(cycles)]++;
+        total++;
+        sum += cycles;
+        if (cycles > maxCycles) maxCycles = cycles;
+    }
+
+    uint32_t quantile(float q) const {
+        if (total == 0) return 0;
+        uint32_t target = (uint32_t)(q * total);
+        uint32_t acc = 0;
+        for (size_t b = 0; b < BUCKETS; b++) {
+            acc += counts[b];
+            if (acc > target) return min(upperEdge(b), maxCycles);
+        }
+        return maxCycles;
+    }
+};
+
+
+class LoopMetrics_Manager {
+
+private:
+
+    AsyncWebServer* server;
+    StepTiming_Analyzer* motors[2];
+
+    CycleHistogram stages[METRIC_STAGE_COUNT];
+    uint32_t cpuMHz;
+    uint32_t overheadCycles;      // вартість однієї пари MARK + RECORD
+    volatile bool resetRequested; // ставить обробник HTTP, виконує такт керування
+
+    float toMicros(uint32_t cycles) const { return cycles / (float)cpuMHz; }
+
+    static const String& textPrometheus() { static const String ct("text/plain; version=0.0.4"); return ct; }
+
+    static const char* stageName(uint8_t s) {
+        static const char* NAMES[METRIC_STAGE_COUNT] = {
+            "steps", "tick", "period", "mpu", "pid", "motors", "record"
+        };
+        return NAMES[s];
+    }
+
+    // Вартість самого вимірювання, на старті
+    void calibrate() {
+        CycleHistogram scratch;
+        scratch.reset();
+        const int N = 1000;
+        uint32_t start = ESP.getCycleCount();
+        for (int i = 0; i < N; i++) {
+            uint32_t t = ESP.getCycleCount();
+            scratch.add(ESP.getCycleCount() - t);
+        }
+        overheadCycles = (ESP.getCycleCount() - start) / N;
+    }
+
+    void printPrometheus(Print& out) const {
+        out.print("# HELP robot_stage_us Control loop stage duration, microseconds\n");
+        out.print("# TYPE robot_stage_us summary\n");
+        for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+            const CycleHistogram& h = stages[s];
+            out.printf("robot_stage_us{stage=\"%s\",quantile=\"0.5\"} %.2f\n",  stageName(s), toMicros(h.quantile(0.5f)));
+            out.printf("robot_stage_us{stage=\"%s\",quantile=\"0.99\"} %.2f\n", stageName(s), toMicros(h.quantile(0.99f)));
+            out.printf("robot_stage_us{stage=\"%s\",quantile=\"1\"} %.2f\n",    stageName(s), toMicros(h.maxCycles));
+            out.printf("robot_stage_us_sum{stage=\"%s\"} %.1f\n",  stageName(s), h.sum / (double)cpuMHz);
+            out.printf("robot_stage_us_count{stage=\"%s\"} %lu\n", stageName(s), (unsigned long)h.total);
+        }
+
+        static const char* MOTOR[2] = { "left", "right" };
+        out.print("# TYPE robot_steps_total counter\n");
+        out.print("# TYPE robot_steps_late_total counter\n");
+        out.print("# TYPE robot_steps_missed_total counter\n");
+        out.print("# TYPE robot_step_max_late_us gauge\n");
+        out.print("# TYPE robot_step_jitter_rms_us gauge\n");
+        out.print("# TYPE robot_step_pulse_violations_total counter\n");
+        out.print("# TYPE robot_step_max_pulse_us gauge\n");
+        out.print("# HELP robot_step_position_error Produced minus ideal position, steps\n");
+        out.print("# TYPE robot_step_position_error gauge\n");
+        unsigned long now = micros();
+        for (int m = 0; m < 2; m++) {
+            if (!motors[m]) continue;
+            const StepTiming_Analyzer& t = *motors[m];
+            out.printf("robot_steps_total{motor=\"%s\"} %lu\n",                 MOTOR[m], (unsigned long)t.getSteps());
+            out.printf("robot_steps_late_total{motor=\"%s\"} %lu\n",            MOTOR[m], (unsigned long)t.getLateSteps());
+            out.printf("robot_steps_missed_total{motor=\"%s\"} %lu\n",          MOTOR[m], (unsigned long)t.getMissedSteps());
+            out.printf("robot_step_max_late_us{motor=\"%s\"} %lu\n",            MOTOR[m], (unsigned long)t.getMaxLateMicros());
+            out.printf("robot_step_jitter_rms_us{motor=\"%s\"} %.2f\n",         MOTOR[m], t.getJitterRmsMicros());
+            out.printf("robot_step_pulse_violations_total{motor=\"%s\"} %lu\n", MOTOR[m], (unsigned long)t.getPulseViolations());
+            out.printf("robot_step_max_pulse_us{motor=\"%s\"} %lu\n",           MOTOR[m], (unsigned long)t.getMaxPulseMicros());
+            out.printf("robot_step_position_error{motor=\"%s\"} %.1f\n",        MOTOR[m], t.getPositionError(now));
+        }
+
+        out.print("# TYPE robot_metrics_overhead_cycles gauge\n");
+        out.printf("robot_metrics_overhead_cycles %lu\n", (unsigned long)overheadCycles);
+        out.print("# TYPE robot_log_dropped_total counter\n");
+        out.printf("robot_log_dropped_total %lu\n", (unsigned long)Log().getDropped());
+    }
+
+    // stages: { name: [p50_us, p99_us, max_us, count] }
+    // steps:  { name: [steps, late, missed, maxLateUs, jitterRmsUs, pulseViolations, maxPulseUs, positionError] }
+    void printJson(Print& out) const {
+        out.printf("{\"cpuMHz\":%lu,\"overheadCycles\":%lu,\"stages\":{",
+                   (unsigned long)cpuMHz, (unsigned long)overheadCycles);
+        for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+            const CycleHistogram& h = stages[s];
+            out.printf("%s\"%s\":[%.1f,%.1f,%.1f,%lu]", s ? "," : "", stageName(s),
+                       toMicros(h.quantile(0.5f)), toMicros(h.quantile(0.99f)),
+                       toMicros(h.maxCycles), (unsigned long)h.total);
+        }
+        out.print("},\"steps\":{");
+        static const char* MOTOR[2] = { "left", "right" };
+        unsigned long now = micros();
+        for (int m = 0; m < 2; m++) {
+            if (!motors[m]) continue;
+            const StepTiming_Analyzer& t = *motors[m];
+            out.printf("%s\"%s\":[%lu,%lu,%lu,%lu,%.2f,%lu,%lu,%.1f]", m ? "," : "", MOTOR[m],
+                       (unsigned long)t.getSteps(),
+                       (unsigned long)t.getLateSteps(),
+                       (unsigned long)t.getMissedSteps(),
+                       (unsigned long)t.getMaxLateMicros(),
+                       t.getJitterRmsMicros(),
+                       (unsigned long)t.getPulseViolations(),
+                       (unsigned long)t.getMaxPulseMicros(),
+                       t.getPositionError(now));
+        }
+        out.print("}}");
+    }
+
+public:
+
+    LoopMetrics_Manager(AsyncWebServer* server)
+        : server(server), motors{nullptr, nullptr}
+        , cpuMHz(240), overheadCycles(0), resetRequested(false)
+    {
+        for (auto& h : stages) h.reset();
+    }
+
+    template <typename LeftMotor, typename RightMotor>
+    void begin(LeftMotor& left, RightMotor& right) {
+        motors[0]  = &left.getTiming();
+        motors[1]  = &right.getTiming();
+        cpuMHz     = ESP.getCpuFreqMHz();
+        calibrate();
+
+        // /metrics — формат Prometheus, /metrics.json — компактно; ?reset — обнулити
+        auto handler = [this](AsyncWebServerRequest *req, bool json) {
+            if (WebRequest::findParam(req, "reset")) resetRequested = true;
+            AsyncResponseStream *res = req->beginResponseStream(json ? WebRequest::appJson() : textPrometheus());
+            if (json) printJson(*res);
+            else      printPrometheus(*res);
+            req->send(res);
+        };
+        server->on("/metrics.json", HTTP_GET, [handler](AsyncWebServerRequest *req) { handler(req, true); });
+        server->on("/metrics",      HTTP_GET, [handler](AsyncWebServerRequest *req) { handler(req, false); });
+
+        LOG_I("metrics: %lu MHz, overhead %lu cycles per sample",
+              (unsigned long)cpuMHz, (unsigned long)overheadCycles);
+    }
+
+    // === Такт керування ===
+    // Скидання — тут, а не в обробнику: аналізатори кроків оновлює
+    // pollStep() на цьому ж ядрі, AsyncTCP розірвав би їхні лічильники
+    void record(MetricStage stage, uint32_t cycles) {
+        if (resetRequested) {
+            for (auto& h : stages) h.reset();
+            unsigned long now = micros();
+            motors[0]->reset(now);
+            motors[1]->reset(now);
+            resetRequested = false;
+        }
+        stages[stage].add(cycles);
+    }
+
+    void recordMicros(MetricStage stage, uint32_t us) {
+        record(stage, us < UINT32_MAX / cpuMHz ? us * cpuMHz : UINT32_MAX);
+    }
+
+};
+
+#else
+
+#define METRICS_MARK(var)                do {} while (0)
+#define METRICS_RECORD(mgr, stage, var)  do {} while (0)
+#define METRICS_RECORD_US(mgr, stage, us) do {} while (0)
+
+class LoopMetrics_Manager {
+public:
+    LoopMetrics_Manager(AsyncWebServer*) {}
+    template <typename LeftMotor, typename RightMotor>
+    void begin(LeftMotor&, RightMotor&) {}
+};
+
+#endif
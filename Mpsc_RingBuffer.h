@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+
+
+// =========================================================
+//  Кільцевий буфер без блокувань: багато виробників, один споживач
+//  (обмежена черга Вьюкова з номером послідовності в кожній комірці)
+//  Виробник резервує комірку через CAS, заповнює її на місці і
+//  публікує commit(); якщо місця немає — reserve() повертає nullptr
+//  N — степінь двійки
+// =========================================================
+
+template <typename T, size_t N>
+class Mpsc_RingBuffer {
+
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+private:
+
+    struct Cell {
+        std::atomic<uint32_t> seq;
+        T data;
+    };
+
+    Cell cells[N];
+    std::atomic<uint32_t> enqueuePos;
+    uint32_t dequeuePos;               // лише споживач
+
+public:
+
+    Mpsc_RingBuffer() : enqueuePos(0), dequeuePos(0) {
+        for (size_t i = 0; i < N; i++) cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // === Виробники ===
+    T* reserve(uint32_t& ticket) {
+        uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & (N - 1)];
+            int32_t diff = (int32_t)(cell.seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ticket = pos;
+                    return &cell.data;
+                }
+            } else if (diff < 0) {
+                return nullptr;   // повна
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void commit(uint32_t ticket) {
+        cells[ticket & (N - 1)].seq.store(ticket + 1, std::memory_order_release);
+    }
+
+    // === Споживач ===
+    // Порожньо або наступна комірка ще заповнюється — false
+    bool pop(T& item) {
+        Cell& cell = cells[dequeuePos & (N - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != dequeuePos + 1) return false;
+        item = cell.data;
+        cell.seq.store(dequeuePos + N, std::memory_order_release);
+        dequeuePos++;
+        return true;
+    }
+
+    size_t capacity() const { return N; }
+
+};
@@ -6,125 +6,299 @@
 #include <WiFi.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <esp_wifi.h>
 
+#include "DeferredLog_Manager.h"
+
+
+// =========================================================
+//  WiFi без блокування: AP піднімається одразу, STA підключається
+//  паралельно (режим AP+STA) і перепідключається сам
+//
+//  begin() лише запускає радіо і повертається — такт керування
+//  стартує без очікування мережі. Події WiFi (окреме завдання ядра)
+//  тільки ставлять прапорці; переходи станів, тайм-аут спроби і
+//  паузи між спробами — у фоновому завданні "wifi".
+//  AP лишається увімкненим і після підключення STA; канал AP
+//  переходить на канал роутера
+//
+//  Спроба STA сканує чужі канали — телефон на AP на цей час
+//  втрачає зв'язок, і спрацьовує тайм-аут команд. Тому спроби
+//  стоять, поки до AP підключений хоч один клієнт, а після
+//  MAX_FAILED_ATTEMPTS невдач поспіль ідуть лише раз на RETRY_MAX_MS —
+//  роутер, що з'явився знову, робот знайде без перезапуску
+// =========================================================
+
+enum WiFiLinkState : uint8_t {
+    WIFI_LINK_IDLE = 0,       // STA не налаштовано
+    WIFI_LINK_CONNECTING,     // спроба підключення
+    WIFI_LINK_CONNECTED,      // STA отримала IP
+    WIFI_LINK_BACKOFF,        // пауза перед наступною спробою
+    WIFI_LINK_PAUSED,         // клієнт на AP — спроби STA стоять
+};
 
 class NetworkConnection_Manager {
 
+public:
+
+    static constexpr uint32_t SUPERVISE_PERIOD_MS = 100;
+    static constexpr uint32_t RETRY_MIN_MS        = 1000;
+    static constexpr uint32_t RETRY_MAX_MS        = 30000;
+    static constexpr uint8_t  MAX_FAILED_ATTEMPTS = 5;
+
 private:
 
-    String STA_SSID;
-    String STA_PASS;
-    String AP_SSID;
-    String AP_PASS;
+    // Рядки живуть весь час роботи (літерали з main.cpp) — без копій у купі
+    const char* STA_SSID;
+    const char* STA_PASS;
+    const char* AP_SSID;
+    const char* AP_PASS;
+
+    uint16_t timeout;             // тривалість однієї спроби STA, мс
+
+    // === Стан (пише лише завдання "wifi") ===
+    volatile WiFiLinkState state;
+    unsigned long stateSinceMs;
+    uint32_t      retryDelayMs;
+    uint32_t      attempts;
+    uint8_t       failures;       // невдалих спроб поспіль
+
+    // === Прапорці від подій WiFi ===
+    volatile bool    apUp;
+    volatile bool    gotIp;
+    volatile bool    disconnected;
+    volatile uint8_t disconnectReason;
+    volatile uint8_t apStations;   // клієнтів на AP
+
+    // === Час від скидання, мс (0 — ще не було) ===
+    volatile unsigned long apReadyMs;
+    volatile unsigned long staReadyMs;
+
+    void onEvent(arduino_event_id_t event, arduino_event_info_t info) {
+        switch (event) {
+            case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+                gotIp = true;
+                break;
+            case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+                disconnectReason = info.wifi_sta_disconnected.reason;
+                disconnected     = true;
+                break;
+            case ARDUINO_EVENT_WIFI_AP_START:
+                apUp = true;
+                break;
+            case ARDUINO_EVENT_WIFI_AP_STACONNECTED:
+                apStations = apStations + 1;
+                break;
+            case ARDUINO_EVENT_WIFI_AP_STADISCONNECTED:
+                if (apStations) apStations = apStations - 1;
+                break;
+            default:
+                break;
+        }
+    }
+
+    static void superviseTask(void* arg) {
+        NetworkConnection_Manager* self = static_cast<NetworkConnection_Manager*>(arg);
+        for (;;) {
+            self->supervise(millis());
+            vTaskDelay(pdMS_TO_TICKS(SUPERVISE_PERIOD_MS));
+        }
+    }
+
+    void setState(WiFiLinkState s, unsigned long now) {
+        state        = s;
+        stateSinceMs = now;
+    }
+
+    void startAttempt(unsigned long now) {
+        attempts++;
+        LOG_I("WiFi: STA %s, attempt %lu", STA_SSID, (unsigned long)attempts);
+        setState(WIFI_LINK_CONNECTING, now);
+        WiFi.begin(STA_SSID, STA_PASS);
+    }
+
+    void scheduleRetry(unsigned long now) {
+        setState(WIFI_LINK_BACKOFF, now);
+    }
 
-    uint16_t timeout;
-    
+    void failAttempt(unsigned long now) {
+        if (failures < MAX_FAILED_ATTEMPTS && ++failures == MAX_FAILED_ATTEMPTS) {
+            LOG_W("WiFi: STA %s failed %u times, retrying every %lu s", STA_SSID,
+                  (unsigned)failures, (unsigned long)(RETRY_MAX_MS / 1000));
+            retryDelayMs = RETRY_MAX_MS;
+        }
+        scheduleRetry(now);
+    }
 
 public:
 
     NetworkConnection_Manager(
-        String sta_ssid, String sta_pass, 
-        String ap_ssid, String ap_pass, 
+        const char* sta_ssid, const char* sta_pass, 
+        const char* ap_ssid, const char* ap_pass, 
         uint16_t timeout = 10000
     ) :
         STA_SSID(sta_ssid), 
         STA_PASS(sta_pass), 
         AP_SSID(ap_ssid), 
         AP_PASS(ap_pass), 
-        timeout(timeout)
+        timeout(timeout),
+        state(WIFI_LINK_IDLE), stateSinceMs(0),
+        retryDelayMs(RETRY_MIN_MS), attempts(0), failures(0),
+        apUp(false), gotIp(false), disconnected(false), disconnectReason(0), apStations(0),
+        apReadyMs(0), staReadyMs(0)
     {}
 
-    bool connectToExternalWiFi()
+    // Запуск радіо; повертається одразу, не чекаючи підключення
+    void begin()
     {
-        Serial.println("\n--- Attempting to connect to external WiFi ---");
-        Serial.print("SSID: ");
-        Serial.println(STA_SSID);
-        
-        WiFi.mode(WIFI_STA);
-        WiFi.begin(STA_SSID, STA_PASS);
+        WiFi.persistent(false);
+        WiFi.setAutoReconnect(false);     // перепідключення — наше, з паузами
+        WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+            onEvent(event, info);
+        });
+        WiFi.mode(WIFI_AP_STA);
+
+        if (WiFi.softAP(AP_SSID, AP_PASS)) {
+            apUp      = true;
+            apReadyMs = millis();
+            char ip[16];
+            IPAddress a = WiFi.softAPIP();
+            snprintf(ip, sizeof(ip), "%u.%u.%u.%u", a[0], a[1], a[2], a[3]);
+            LOG_I("WiFi: AP %s, IP %s, %lu ms after reset", AP_SSID, ip, (unsigned long)apReadyMs);
+        } else {
+            LOG_E("WiFi: AP %s failed to start", AP_SSID);
+        }
 
-        uint32_t startTime = millis();
+        if (STA_SSID && *STA_SSID) {
+            startAttempt(millis());
+        }
+
+        xTaskCreatePinnedToCore(superviseTask, "wifi", 3072, this, 1, nullptr, 0);
+    }
 
-        while (WiFi.status() != WL_CONNECTED && millis() - startTime < timeout)
-        {
-            delay(500);
-            Serial.print(".");
+    // Крок автомата: завдання "wifi" кожні SUPERVISE_PERIOD_MS; тести — напряму
+    void supervise(unsigned long now) {
+        if (disconnected) {
+            disconnected = false;
+            if (state == WIFI_LINK_CONNECTED || state == WIFI_LINK_CONNECTING) {
+                LOG_W("WiFi: STA %s disconnected (reason %u)", STA_SSID, (unsigned)disconnectReason);
+                if (state == WIFI_LINK_CONNECTING) failAttempt(now);
+                else                               scheduleRetry(now);
+            }
         }
 
-        if (WiFi.status() == WL_CONNECTED)
-        {
-            Serial.println("\n✓ WiFi connected successfully!");
-            Serial.print("IP address: ");
-            Serial.println(WiFi.localIP());
-            Serial.print("Signal strength: ");
-            Serial.print(WiFi.RSSI());
-            Serial.println(" dBm");
-            return true;
+        if (gotIp) {
+            gotIp = false;
+            if (state != WIFI_LINK_CONNECTED) {
+                setState(WIFI_LINK_CONNECTED, now);
+                retryDelayMs = RETRY_MIN_MS;
+                failures     = 0;
+                if (!staReadyMs) staReadyMs = now;
+                char ip[16];
+                formatIP(ip, sizeof(ip));
+                LOG_I("WiFi: STA %s connected, IP %s, RSSI %d dBm, %lu ms after reset",
+                      STA_SSID, ip, WiFi.RSSI(), now);
+            }
+        }
+
+        // Клієнт на AP: перервати спробу, нових не починати.
+        // Перервана спроба не рахується як невдача
+        if (apStations) {
+            if (state == WIFI_LINK_CONNECTING || state == WIFI_LINK_BACKOFF) {
+                LOG_I("WiFi: AP client connected, STA %s paused", STA_SSID);
+                bool abort = state == WIFI_LINK_CONNECTING;
+                setState(WIFI_LINK_PAUSED, now);
+                if (abort) WiFi.disconnect();
+            }
+        } else if (state == WIFI_LINK_PAUSED) {
+            LOG_I("WiFi: no AP clients, STA %s resumed", STA_SSID);
+            scheduleRetry(now);
+        }
+
+        switch (state) {
+            case WIFI_LINK_CONNECTING:
+                if (now - stateSinceMs >= timeout) {
+                    LOG_W("WiFi: STA %s timeout after %u ms", STA_SSID, (unsigned)timeout);
+                    failAttempt(now);          // спершу стан — подія DISCONNECTED його не чіпає
+                    WiFi.disconnect();
+                }
+                break;
+            case WIFI_LINK_BACKOFF:
+                if (now - stateSinceMs >= retryDelayMs) {
+                    uint32_t next = retryDelayMs * 2;
+                    retryDelayMs  = next < RETRY_MAX_MS ? next : RETRY_MAX_MS;
+                    startAttempt(now);
+                }
+                break;
+            default:
+                break;
         }
-        
-        Serial.println("\n✗ WiFi connection failed (timeout)");
-        return false;
     }
 
-    bool setupLocalWiFi()
+    IPAddress getIP() const
     {
-        Serial.println("\n--- Setting up Access Point ---");
-        Serial.print("AP SSID: ");
-        Serial.println(AP_SSID);
-        
-        WiFi.mode(WIFI_AP);
-        bool success = WiFi.softAP(AP_SSID, AP_PASS);
-        
-        if (success) {
-            Serial.println("✓ Access Point started successfully!");
-            Serial.print("AP IP address: ");
-            Serial.println(WiFi.softAPIP());
+        if (state == WIFI_LINK_CONNECTED) {
+            return WiFi.localIP();
         } else {
-            Serial.println("✗ Access Point failed to start!");
+            return WiFi.softAPIP();
         }
-        
-        return success;
     }
 
- 
+    // "a.b.c.d" у буфер викликача (мін. 16 байт), без String
+    size_t formatIP(char* buf, size_t len) const
+    {
+        IPAddress ip = getIP();
+        int n = snprintf(buf, len, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+        return n < 0 ? 0 : (size_t)n;
+    }
 
-    String getIP() const
+    // STA підключена: рівень сигналу роутера
+    // Інакше: найсильніший з клієнтів AP (0 — нікого немає)
+    int8_t getRSSI() const
     {
-        if (WiFi.getMode() == WIFI_STA) {
-            return WiFi.localIP().toString();
-        } else {
-            return WiFi.softAPIP().toString();
+        if (state == WIFI_LINK_CONNECTED) {
+            return WiFi.RSSI();
         }
+
+        wifi_sta_list_t stations;
+        if (esp_wifi_ap_get_sta_list(&stations) != ESP_OK || stations.num == 0) {
+            return 0;
+        }
+        int8_t best = -127;
+        for (int i = 0; i < stations.num; i++) {
+            if (stations.sta[i].rssi > best) best = stations.sta[i].rssi;
+        }
+        return best;
     }
 
     bool isConnected() const
     {
-        return WiFi.status() == WL_CONNECTED || WiFi.getMode() == WIFI_AP;
+        return state == WIFI_LINK_CONNECTED || apUp;
     }
 
-    String getMode() const
+    bool isStationConnected() const { return state == WIFI_LINK_CONNECTED; }
+    WiFiLinkState getState()  const { return state; }
+    uint8_t getApStations()       const { return apStations; }
+    unsigned long getApReadyMs()  const { return apReadyMs; }
+    unsigned long getStaReadyMs() const { return staReadyMs; }
+
+    const char* getMode() const
     {
-        wifi_mode_t mode = WiFi.getMode();
-        if (mode == WIFI_STA) return "STA";
-        if (mode == WIFI_AP) return "AP";
+        if (state == WIFI_LINK_CONNECTED) return apUp ? "AP+STA" : "STA";
+        if (apUp) return "AP";
         return "OFF";
     }
 
  
     void printStatus() const
     {
-        Serial.println("\n=== WiFi Status ===");
-        Serial.print("Mode: ");
-        Serial.println(getMode());
-        Serial.print("IP: ");
-        Serial.println(getIP());
-        
-        if (WiFi.getMode() == WIFI_STA) {
-            Serial.print("RSSI: ");
-            Serial.print(WiFi.RSSI());
-            Serial.println(" dBm");
+        char ip[16];
+        formatIP(ip, sizeof(ip));
+
+        if (state == WIFI_LINK_CONNECTED) {
+            LOG_I("WiFi: mode %s, IP %s, RSSI %d dBm", getMode(), ip, WiFi.RSSI());
+        } else {
+            LOG_I("WiFi: mode %s, IP %s", getMode(), ip);
         }
-        
-        Serial.println("===================\n");
     }
 };
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+
+
+// =========================================================
+//  Налаштування робота: калібрування IMU, коефіцієнти, межі
+//  Не залежить від Arduino — зберігає RobotConfig_Store (NVS)
+//
+//  Blob: magic "RCFG" | version u16 | size u16 | RobotConfig | crc32
+//  CRC рахується по всьому, крім самого crc. Інша версія, розмір
+//  або CRC — blob відкидається і беруться значення за замовчуванням
+// =========================================================
+
+enum RobotConfigFlags : uint32_t {
+    CONFIG_BOOT_CALIBRATE = 1,     // швидке калібрування гіроскопа на старті
+};
+
+struct RobotConfig {
+    // === IMU: зміщення гіроскопа, °/с ===
+    float gyroOffsetX;
+    float gyroOffsetY;
+    float gyroOffsetZ;
+
+    // === Баланс ===
+    float innerKp;
+    float innerKi;
+    float innerKd;
+    float outerKp;
+    float balanceOffset;     // кут рівноваги, °
+
+    // === Поворот ===
+    float steerKp;
+    float steerKi;
+    float gyroWeight;
+    float gyroSign;          // знак осі Z: -1 — плата Z догори (поворот вправо дає gyroZ < 0)
+
+    // === Геометрія: перерахунок кр/с у °/с для повороту ===
+    float wheelDiameterMm;
+    float trackWidthMm;
+    float stepsPerRev;       // з мікрокроком
+
+    // === Межі ===
+    float maxSpeed;          // кр/с
+    float maxSteer;          // кр/с
+    float fallAngle;         // °
+
+    uint32_t flags;
+};
+
+// Поле для HTTP та JSON: ім'я, зміщення в RobotConfig, допустимий діапазон
+struct RobotConfig_FieldInfo {
+    const char* name;
+    uint16_t    offset;
+    float       minValue;
+    float       maxValue;
+};
+
+#define RCFG_FIELD(f, lo, hi) { #f, (uint16_t)offsetof(RobotConfig, f), lo, hi }
+
+static const RobotConfig_FieldInfo RCFG_FIELDS[] = {
+    RCFG_FIELD(gyroOffsetX,     -250.0f,   250.0f),
+    RCFG_FIELD(gyroOffsetY,     -250.0f,   250.0f),
+    RCFG_FIELD(gyroOffsetZ,     -250.0f,   250.0f),
+    RCFG_FIELD(innerKp,            0.0f,  5000.0f),
+    RCFG_FIELD(innerKi,            0.0f, 50000.0f),
+    RCFG_FIELD(innerKd,            0.0f,   500.0f),
+    RCFG_FIELD(outerKp,            0.0f,   100.0f),
+    RCFG_FIELD(balanceOffset,    -15.0f,    15.0f),
+    RCFG_FIELD(steerKp,            0.0f,   100.0f),
+    RCFG_FIELD(steerKi,            0.0f,   100.0f),
+    RCFG_FIELD(gyroWeight,         0.0f,     1.0f),
+    RCFG_FIELD(gyroSign,          -1.0f,     1.0f),
+    RCFG_FIELD(wheelDiameterMm,   20.0f,   300.0f),
+    RCFG_FIELD(trackWidthMm,      50.0f,   600.0f),
+    RCFG_FIELD(stepsPerRev,      200.0f, 25600.0f),
+    RCFG_FIELD(maxSpeed,         100.0f, 50000.0f),
+    RCFG_FIELD(maxSteer,           0.0f, 10000.0f),
+    RCFG_FIELD(fallAngle,          5.0f,    80.0f),
+};
+
+#undef RCFG_FIELD
+
+static const size_t RCFG_FIELD_COUNT = sizeof(RCFG_FIELDS) / sizeof(RCFG_FIELDS[0]);
+
+
+namespace RobotConfigFormat {
+
+    static const uint8_t  MAGIC[4] = { 'R', 'C', 'F', 'G' };
+    static const uint16_t VERSION  = 2;     // 2: gyroSign і геометрія
+
+    struct Blob {
+        uint8_t     magic[4];
+        uint16_t    version;
+        uint16_t    size;
+        RobotConfig config;
+        uint32_t    crc;
+    };
+
+    // Значення, які раніше були прошиті в setup()
+    inline RobotConfig defaults() {
+        RobotConfig c;
+        memset(&c, 0, sizeof(c));
+        c.gyroOffsetX     = 1.0f;
+        c.gyroOffsetY     = 0.0f;
+        c.gyroOffsetZ     = -1.0f;
+        c.innerKp         = 600.0f;
+        c.innerKi         = 5000.0f;
+        c.innerKd         = 15.0f;
+        c.outerKp         = 3.0f;
+        c.balanceOffset   = 0.0f;
+        c.steerKp         = 1.0f;
+        c.steerKi         = 2.0f;
+        c.gyroWeight      = 1.0f;
+        c.gyroSign        = -1.0f;
+        c.wheelDiameterMm = 65.0f;
+        c.trackWidthMm    = 180.0f;
+        c.stepsPerRev     = 3200.0f;
+        c.maxSpeed        = 50000.0f;
+        c.maxSteer        = 2000.0f;
+        c.fallAngle       = 40.0f;
+        c.flags           = 0;
+        return c;
+    }
+
+    // CRC-32 (IEEE 802.3, відбитий поліном), без таблиці — blob малий
+    inline uint32_t crc32(const uint8_t* data, size_t len) {
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < len; i++) {
+            crc ^= data[i];
+            for (int b = 0; b < 8; b++) {
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+            }
+        }
+        return ~crc;
+    }
+
+    inline void seal(Blob& blob, const RobotConfig& config) {
+        memset(&blob, 0, sizeof(blob));
+        memcpy(blob.magic, MAGIC, sizeof(MAGIC));
+        blob.version = VERSION;
+        blob.size    = sizeof(RobotConfig);
+        blob.config  = config;
+        blob.crc     = crc32((const uint8_t*)&blob, offsetof(Blob, crc));
+    }
+
+    inline bool verify(const Blob& blob) {
+        return memcmp(blob.magic, MAGIC, sizeof(MAGIC)) == 0
+            && blob.version == VERSION
+            && blob.size == sizeof(RobotConfig)
+            && blob.crc == crc32((const uint8_t*)&blob, offsetof(Blob, crc));
+    }
+
+    inline float* fieldPtr(RobotConfig& c, size_t i) {
+        return (float*)((uint8_t*)&c + RCFG_FIELDS[i].offset);
+    }
+
+    inline float fieldValue(const RobotConfig& c, size_t i) {
+        float v;
+        memcpy(&v, (const uint8_t*)&c + RCFG_FIELDS[i].offset, sizeof(v));
+        return v;
+    }
+
+    inline int findField(const char* name) {
+        for (size_t i = 0; i < RCFG_FIELD_COUNT; i++) {
+            if (strcmp(RCFG_FIELDS[i].name, name) == 0) return (int)i;
+        }
+        return -1;
+    }
+
+    // У межах поля і не NaN
+    inline bool inRange(size_t i, float v) {
+        return v >= RCFG_FIELDS[i].minValue && v <= RCFG_FIELDS[i].maxValue;
+    }
+
+}
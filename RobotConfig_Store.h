@@ -0,0 +1,227 @@
+#pragma once
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <MPU6050_tockn.h>
+#include <Preferences.h>
+#include <stdlib.h>
+
+#include "RobotConfig_Format.h"
+#include "Spsc_RingBuffer.h"
+#include "DeferredLog_Manager.h"
+#include "WebRequest_Helpers.h"
+
+
+
+// =========================================================
+//  Налаштування в NVS: завантаження на старті, зміни через HTTP
+//
+//  /config            поточні значення (JSON)
+//  /config/set        ?innerKp=650&fallAngle=35&bootCalibrate=1 ...
+//                     застосовує наступний такт керування, без скидання
+//                     інтеграторів; у flash не пише
+//  /config/save       записати поточні значення в NVS; 409, поки робот балансує
+//  /config/defaults   повернути значення за замовчуванням (без запису)
+//
+//  Запис у flash на кілька мс зупиняє кеш обох ядер — разом
+//  з генерацією кроків. Тому збереження дозволене, лише коли
+//  робот упав або баланс вимкнено (прапорець ставить такт)
+// =========================================================
+
+class RobotConfig_Store {
+
+public:
+
+    static constexpr size_t CALIBRATION_SAMPLES = 200;     // ~0.3 с
+    static constexpr float  STILL_RANGE_DPS     = 2.0f;    // більший розкид — робот рухається
+    static constexpr float  RESAVE_DRIFT_DPS    = 0.2f;    // зміщення змінилось — зберегти
+
+private:
+
+    AsyncWebServer* server;
+    Preferences prefs;
+
+    // Пише лише HTTP (після begin()); такт отримує копії через кільце
+    RobotConfig current;
+    Spsc_RingBuffer<RobotConfig, 2> updates;
+    bool fromNvs;
+    volatile bool saveAllowed;    // пише такт керування, читає HTTP
+
+    bool parseFloat(const char* str, float& out) {
+        char* end;
+        out = strtof(str, &end);
+        return end != str && *end == '\0';
+    }
+
+    void printJson(Print& out) const {
+        out.printf("{\"version\":%u,\"source\":\"%s\",\"bootCalibrate\":%s",
+                   (unsigned)RobotConfigFormat::VERSION, fromNvs ? "nvs" : "defaults",
+                   (current.flags & CONFIG_BOOT_CALIBRATE) ? "true" : "false");
+        for (size_t i = 0; i < RCFG_FIELD_COUNT; i++) {
+            out.printf(",\"%s\":%g", RCFG_FIELDS[i].name, RobotConfigFormat::fieldValue(current, i));
+        }
+        out.print("}");
+    }
+
+    void sendJson(AsyncWebServerRequest *req) {
+        AsyncResponseStream *res = req->beginResponseStream(WebRequest::appJson());
+        printJson(*res);
+        req->send(res);
+    }
+
+    // Усі параметри перевіряються до застосування: одне погане — нічого не змінено
+    void handleSet(AsyncWebServerRequest *req) {
+        RobotConfig next = current;
+        size_t n = req->params();
+        for (size_t i = 0; i < n; i++) {
+            const AsyncWebParameter* p = req->getParam(i);
+            if (p->isPost() || p->isFile()) continue;
+            const char* name = p->name().c_str();
+            float value;
+            if (!parseFloat(p->value().c_str(), value)) {
+                WebRequest::sendBuffer(req, WebRequest::textPlain(), name, 400);
+                return;
+            }
+            if (strcmp(name, "bootCalibrate") == 0) {
+                if (value != 0.0f) next.flags |=  CONFIG_BOOT_CALIBRATE;
+                else               next.flags &= ~CONFIG_BOOT_CALIBRATE;
+                continue;
+            }
+            int f = RobotConfigFormat::findField(name);
+            if (f < 0 || !RobotConfigFormat::inRange(f, value)) {
+                WebRequest::sendBuffer(req, WebRequest::textPlain(), name, 400);
+                return;
+            }
+            *RobotConfigFormat::fieldPtr(next, f) = value;
+        }
+        publish(next, req);
+    }
+
+    void publish(const RobotConfig& next, AsyncWebServerRequest *req) {
+        if (!updates.push(next)) {
+            static const char BUSY[] PROGMEM = "busy, retry";
+            WebRequest::sendText_P(req, 503, BUSY);
+            return;
+        }
+        current = next;
+        sendJson(req);
+    }
+
+public:
+
+    RobotConfig_Store(AsyncWebServer* server)
+        : server(server)
+        , current(RobotConfigFormat::defaults())
+        , fromNvs(false)
+        , saveAllowed(true)
+    {}
+
+    // === Старт, до RobotController::begin() ===
+    void load() {
+        unsigned long start = micros();
+        prefs.begin("robot", false);
+
+        RobotConfigFormat::Blob blob;
+        size_t len = prefs.getBytes("cfg", &blob, sizeof(blob));
+        fromNvs = len == sizeof(blob) && RobotConfigFormat::verify(blob);
+        current = fromNvs ? blob.config : RobotConfigFormat::defaults();
+
+        unsigned long took = micros() - start;
+        if (fromNvs) {
+            LOG_I("config: loaded from NVS in %lu us", took);
+        } else {
+            LOG_W("config: %s, using defaults", len ? "NVS blob rejected" : "nothing in NVS");
+        }
+    }
+
+    bool save() {
+        RobotConfigFormat::Blob blob;
+        RobotConfigFormat::seal(blob, current);
+        bool ok = prefs.putBytes("cfg", &blob, sizeof(blob)) == sizeof(blob);
+        if (ok) fromNvs = true;
+        LOG_I("config: %s", ok ? "saved" : "save failed");
+        return ok;
+    }
+
+    // Швидке калібрування гіроскопа: робот має стояти нерухомо.
+    // Рухається — лишаються збережені зміщення
+    bool calibrateGyro(MPU6050& mpu) {
+        float sum[3] = { 0, 0, 0 };
+        float lo[3]  = {  1e9f,  1e9f,  1e9f };
+        float hi[3]  = { -1e9f, -1e9f, -1e9f };
+
+        for (size_t i = 0; i < CALIBRATION_SAMPLES; i++) {
+            mpu.update();
+            // ±500 °/с: 65.5 одиниць на °/с (як у MPU6050_tockn)
+            float g[3] = { mpu.getRawGyroX() / 65.5f, mpu.getRawGyroY() / 65.5f, mpu.getRawGyroZ() / 65.5f };
+            for (int a = 0; a < 3; a++) {
+                sum[a] += g[a];
+                if (g[a] < lo[a]) lo[a] = g[a];
+                if (g[a] > hi[a]) hi[a] = g[a];
+            }
+            delay(1);
+        }
+
+        for (int a = 0; a < 3; a++) {
+            if (hi[a] - lo[a] > STILL_RANGE_DPS) {
+                LOG_W("config: gyro calibration skipped, robot is moving");
+                return false;
+            }
+        }
+
+        float off[3] = { sum[0] / CALIBRATION_SAMPLES, sum[1] / CALIBRATION_SAMPLES, sum[2] / CALIBRATION_SAMPLES };
+        float drift  = fabsf(off[0] - current.gyroOffsetX)
+                     + fabsf(off[1] - current.gyroOffsetY)
+                     + fabsf(off[2] - current.gyroOffsetZ);
+
+        current.gyroOffsetX = off[0];
+        current.gyroOffsetY = off[1];
+        current.gyroOffsetZ = off[2];
+        mpu.setGyroOffsets(off[0], off[1], off[2]);
+        LOG_I("config: gyro offsets %.2f %.2f %.2f °/s", off[0], off[1], off[2]);
+
+        // Не переписуємо flash на кожному старті — лише коли зміщення попливло
+        if (drift > RESAVE_DRIFT_DPS) save();
+        return true;
+    }
+
+    const RobotConfig& get() const { return current; }
+
+    void begin() {
+        // Конкретні шляхи раніше за "/config" — він також ловить "/config/*"
+        server->on("/config/set", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            handleSet(req);
+        });
+
+        server->on("/config/save", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            static const char BALANCING[]   PROGMEM = "balancing, save when fallen or disabled";
+            static const char SAVE_FAILED[] PROGMEM = "save failed";
+            if (!saveAllowed) {
+                WebRequest::sendText_P(req, 409, BALANCING);
+                return;
+            }
+            if (save()) sendJson(req);
+            else        WebRequest::sendText_P(req, 500, SAVE_FAILED);
+        });
+
+        server->on("/config/defaults", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            publish(RobotConfigFormat::defaults(), req);
+        });
+
+        server->on("/config", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            sendJson(req);
+        });
+    }
+
+    // === Такт керування ===
+    // true — робот не балансує, запис у flash нічого не зупинить
+    void setSaveAllowed(bool allowed) { saveAllowed = allowed; }
+
+    // Остання зміна з HTTP; false — змін не було
+    bool takeUpdate(RobotConfig& out) {
+        bool any = false;
+        while (updates.pop(out)) any = true;
+        return any;
+    }
+
+};
@@ -4,148 +4,273 @@
 #include <MPU6050_tockn.h>
 
 #include "SteperMotor_Controller.h"
-#include "BalancePID_Manager.h"
+#include "ControlTick_Core.h"
 #include "ControlPage_Routes.h"
-#include "ControlPage_WebPage.h"
 #include "NetworkConnection_Manager.h"
+#include "Telemetry_Stream.h"
+#include "BinaryLog_Sink.h"
+#include "BlackBox_Recorder.h"
+#include "DeferredLog_Manager.h"
+#include "LoopMetrics_Manager.h"
+#include "RobotConfig_Store.h"
 
 
+template <typename LeftMotor, typename RightMotor>
 class RobotController {
 
 public:
 
     MPU6050& mpu6050;
-    StepperMotor_Controller& leftMotor;
-    StepperMotor_Controller& rightMotor;
+    LeftMotor& leftMotor;
+    RightMotor& rightMotor;
     BalanceController& balanceController;
+    SteeringController& steeringController;
     ControlPage_Router& controlRouter;
     NetworkConnection_Manager& networkManager;
+    Telemetry_Stream& telemetry;
+    BinaryLog_Sink& binLog;
+    BlackBox_Recorder& blackBox;
+    LoopMetrics_Manager& metrics;
+    RobotConfig_Store& config;
 
-    const char* controlPage;
+    const ControlPage_Asset& controlPage;
 
-    static constexpr float         FALL_ANGLE      = 40.0f;
-    static constexpr unsigned long PID_INTERVAL_MS = 10;  
+    // Такт без заліза: баланс, поворот, deadman
+    ControlCore core;
 
-    float maxSpeed = 50000.0f;
-    float maxSteer = 2000.0f;
+    static constexpr unsigned long PID_INTERVAL_MS = ControlCore::PID_INTERVAL_MS;
+
+    // === Deadman: втрата зв'язку з веб-сторінкою ===
+    unsigned long linkTimeoutMs = 500;      // без команд довше — зв'язок втрачено
 
     unsigned long lastPidMs = 0;
-    bool fallen = false;
+    unsigned long lastTickUs = 0;
+    unsigned long balancedMs = 0;           // перший такт балансування, мс від скидання
 
 
 public:
 
     RobotController(
         MPU6050& mpu6050,
-        StepperMotor_Controller& leftMotor,
-        StepperMotor_Controller& rightMotor,
+        LeftMotor& leftMotor,
+        RightMotor& rightMotor,
         BalanceController& balanceController,
+        SteeringController& steeringController,
         ControlPage_Router& controlRouter,
         NetworkConnection_Manager& networkManager,
-        const char* controlPage
+        Telemetry_Stream& telemetry,
+        BinaryLog_Sink& binLog,
+        BlackBox_Recorder& blackBox,
+        LoopMetrics_Manager& metrics,
+        RobotConfig_Store& config,
+        const ControlPage_Asset& controlPage
     ) :
         mpu6050(mpu6050),
         leftMotor(leftMotor),
         rightMotor(rightMotor),
         balanceController(balanceController),
+        steeringController(steeringController),
         controlRouter(controlRouter),
         networkManager(networkManager),
-        controlPage(controlPage)
+        telemetry(telemetry),
+        binLog(binLog),
+        blackBox(blackBox),
+        metrics(metrics),
+        config(config),
+        controlPage(controlPage),
+        core(balanceController, steeringController)
     {}
 
 
+    // Калібрування, коефіцієнти, межі. Інтегратори не скидаються —
+    // можна викликати під час балансування
+    void applyConfig(const RobotConfig& c) {
+        mpu6050.setGyroOffsets(c.gyroOffsetX, c.gyroOffsetY, c.gyroOffsetZ);
+        core.applyConfig(c);
+    }
+
+
     void begin() {
+        applyConfig(config.get());
+
         leftMotor.begin();
         rightMotor.begin();
         leftMotor.setMotorEnable(true);
         rightMotor.setMotorEnable(true);
 
-        balanceController.begin();
-        balanceController.setEnabled(true);
+        core.begin(leftMotor.getPosition(), rightMotor.getPosition(), millis());
+
+        telemetry.begin();
+        binLog.begin();
+        blackBox.begin();
+        metrics.begin(leftMotor, rightMotor);
+        config.begin();
 
+        // Мережа не блокує: до server->begin() потрібен лише запущений стек WiFi
+        networkManager.begin();
+        controlRouter.attachNetwork(&networkManager);
         controlRouter.setupRoutes(controlPage);
 
         lastPidMs = millis();
     }
 
 
-    void run() {
+    // IMU — один раз за такт, після mpu6050.update(): той самий знімок
+    // іде у входи ядра, телеметрію і чорну скриньку
+    void readImu(BinaryLog_Tick& t) {
+        t.pitch = mpu6050.getAngleY();
+        t.roll  = mpu6050.getAngleX();
+        t.gyroY = mpu6050.getGyroY();
+        t.gyroZ = mpu6050.getGyroZ();
+        t.accX  = mpu6050.getRawAccX();
+        t.accY  = mpu6050.getRawAccY();
+        t.accZ  = mpu6050.getRawAccZ();
+    }
 
-        // Генерація кроків — ЗАВЖДИ, кожну ітерацію loop()
-        leftMotor.run();
-        rightMotor.run();
 
-        if (fallen) return;
+    // Решта стану такту — лише збереження значень; фіксовану точку
+    // рахує BinaryLog_Tick::toSample() під час кодування
+    void captureSample(BinaryLog_Tick& t, unsigned long now, const ControlOutputs& out, unsigned long tickUs) {
+        t.timeMs      = now;
+        t.targetAngle = balanceController.getTargetAngle();
+        t.targetSpeed = out.targetSpeed;
+        t.baseSpeed   = out.baseSpeed;
+        t.estSpeed    = balanceController.getEstimatedSpeed();
+        t.pidP        = balanceController.getTermP();
+        t.pidI        = balanceController.getTermI();
+        t.pidD        = balanceController.getTermD();
+        t.steerOffset = out.steerOffset;
+        t.yawRate     = steeringController.getMeasuredRate();
+        t.leftSpeed   = out.leftSpeed;
+        t.rightSpeed  = out.rightSpeed;
+        t.leftPos     = leftMotor.getPosition();
+        t.rightPos    = rightMotor.getPosition();
+        t.cmdDir      = out.cmd.direction;
+        t.cmdSpeed    = out.cmd.speed;
+        t.cmdSteer    = out.cmd.steer;
+        t.flags       = (leftMotor.getDirection()  == ROTATE_FORWARD ? TELEM_LEFT_FORWARD  : 0)
+                      | (rightMotor.getDirection() == ROTATE_FORWARD ? TELEM_RIGHT_FORWARD : 0)
+                      | (core.fallen   ? TELEM_FALLEN    : 0)
+                      | (core.linkLost ? TELEM_LINK_LOST : 0);
+        t.tickUs      = tickUs;
+    }
 
-        unsigned long now = millis();
-        if (now - lastPidMs < PID_INTERVAL_MS) return;
-        lastPidMs = now;
 
-        // --- MPU ---
-        mpu6050.update();
-        
+    // Такт керування від готових входів: ядро рахує швидкості,
+    // тут лише мотори, журнал і метрики
+    void step(const ControlInputs& in, ControlOutputs& out) {
+        METRICS_MARK(pidStart);
+        core.step(in, out);
+        METRICS_RECORD(metrics, METRIC_PID, pidStart);
 
-        float pitch = mpu6050.getAngleY();
+        if (out.fell)        LOG_W("[!] СТОП: Робот впав! pitch = %.1f°", in.pitch);
+        if (out.linkDropped) LOG_W("[!] Зв'язок втрачено: плавна зупинка");
 
-        // --- Аварійна зупинка ---
-        if (abs(pitch) > FALL_ANGLE) {
-            leftMotor.setSpeed(0);
-            rightMotor.setSpeed(0);
-            balanceController.emergencyStop();
-            fallen = true;
-            Serial.println("\n[!] СТОП: Робот впав!");
-        }
+        // /config/save — лише поки робот не балансує (запис у flash зупиняє кроки)
+        config.setSaveAllowed(core.fallen || !balanceController.isEnabled());
 
-        else {
-            balanceController.setEnabled(true);
-            fallen = false;
-            lastPidMs = millis();
-        }
+        // --- Застосовуємо до моторів ---
+        METRICS_MARK(motorsStart);
+        leftMotor.setDirection(out.leftSpeed >= 0 ? ROTATE_BACKWARD : ROTATE_FORWARD);
+        leftMotor.setSpeed(abs(out.leftSpeed));
 
+        rightMotor.setDirection(out.rightSpeed >= 0 ? ROTATE_FORWARD : ROTATE_BACKWARD);
+        rightMotor.setSpeed(abs(out.rightSpeed));
+        METRICS_RECORD(metrics, METRIC_MOTORS, motorsStart);
+    }
 
-        // --- Команда від веб-інтерфейсу ---
-        ControlCommand cmd = controlRouter.getCommand();
 
-        float targetSpeed = 0.0f;
-        switch (cmd.direction) {
-            case FORWARD:
+    void run() {
 
-            case FORWARD_LEFT:
+        // Генерація кроків — ЗАВЖДИ, кожну ітерацію loop()
+        METRICS_MARK(stepsStart);
+        runSteppers(leftMotor, rightMotor);
+        METRICS_RECORD(metrics, METRIC_STEPS, stepsStart);
 
-            case FORWARD_RIGHT:  
-                targetSpeed =  (cmd.speed / 255.0f) * maxSpeed; 
-                break;
+        if (core.fallen) return;
 
-            case BACKWARD:
+        unsigned long now = millis();
+        if (now - lastPidMs < PID_INTERVAL_MS) return;
+        lastPidMs = now;
 
-            case BACKWARD_LEFT:
+        METRICS_MARK(tickStart);
+        unsigned long tickStartUs = micros();
+        unsigned long periodUs    = tickStartUs - lastTickUs;
+        if (lastTickUs != 0) METRICS_RECORD_US(metrics, METRIC_PERIOD, periodUs);
+        lastTickUs = tickStartUs;
 
-            case BACKWARD_RIGHT: 
-                targetSpeed = -(cmd.speed / 255.0f) * maxSpeed; 
-                break;
-            default:      
+        // --- Зміни налаштувань з HTTP ---
+        RobotConfig update{};
+        if (config.takeUpdate(update)) applyConfig(update);
 
-                targetSpeed =  0.0f; 
-                break;
+        // --- MPU ---
+        METRICS_MARK(mpuStart);
+        mpu6050.update();
+        METRICS_RECORD(metrics, METRIC_MPU, mpuStart);
+
+        // Слот чорної скриньки; коли запис зупинено — локальний запис
+        BinaryLog_Tick  local;
+        BinaryLog_Tick* tick = blackBox.beginSample();
+        bool recording = tick != nullptr;
+        if (!tick) tick = &local;
+        readImu(*tick);
+
+        ControlInputs in;
+        in.now       = now;
+        in.pitch     = tick->pitch;
+        in.gyroZ     = tick->gyroZ;
+        in.leftPos   = leftMotor.getPosition();
+        in.rightPos  = rightMotor.getPosition();
+        in.cmd       = controlRouter.getCommand();
+        in.linkAlive = controlRouter.isLinkAlive(linkTimeoutMs);
+
+        ControlOutputs out;
+        step(in, out);
+        if (!core.fallen) lastPidMs = millis();
+
+        if (!balancedMs && !core.fallen) {
+            balancedMs = now;
+            LOG_I("Balance loop running %lu ms after reset", now);
         }
 
-        float steerOffset = map(cmd.steer, 0, 100, -maxSteer, maxSteer);
-
-        // --- PID ---
-        balanceController.setTargetSpeed(targetSpeed);
-        balanceController.update(pitch);
-        float baseSpeed = balanceController.getBaseSpeed();
+        // --- Телеметрія: кілька записів у кільцевий буфер, без очікування ---
+        METRICS_MARK(recordStart);
+        if (TelemetryRecord* r = telemetry.beginRecord()) {
+            r->timeMs         = now;
+            r->tickUs         = min(micros() - tickStartUs, 65535UL);
+            r->periodUs       = min(periodUs, 65535UL);
+            r->flags          = (leftMotor.getDirection()  == ROTATE_FORWARD ? TELEM_LEFT_FORWARD  : 0)
+                              | (rightMotor.getDirection() == ROTATE_FORWARD ? TELEM_RIGHT_FORWARD : 0)
+                              | (core.fallen   ? TELEM_FALLEN    : 0)
+                              | (core.linkLost ? TELEM_LINK_LOST : 0);
+            r->pitch          = tick->pitch;
+            r->roll           = tick->roll;
+            r->targetAngle    = balanceController.getTargetAngle();
+            r->baseSpeed      = out.baseSpeed;
+            r->estimatedSpeed = balanceController.getEstimatedSpeed();
+            r->leftSpeed      = out.leftSpeed;
+            r->rightSpeed     = out.rightSpeed;
+            r->leftPosition   = leftMotor.getPosition();
+            r->rightPosition  = rightMotor.getPosition();
+            telemetry.commitRecord();
+        }
 
-        // --- Диференційний поворот ---
-        float leftSpeed  = constrain(baseSpeed + steerOffset, -maxSpeed, maxSpeed);
-        float rightSpeed = constrain(baseSpeed - steerOffset, -maxSpeed, maxSpeed);
+        // --- Чорна скринька + бінарний лог: стан такту пишемо прямо в слот ---
+        bool streaming = binLog.isEnabled();
+        if (recording || streaming) {
+            captureSample(*tick, now, out, micros() - tickStartUs);
+            if (recording) blackBox.commit();
+            if (streaming) {
+                BinaryLog_Sample sample;
+                tick->toSample(sample);
+                binLog.log(sample);
+            }
+        }
 
-        // --- Застосовуємо до моторів ---
-        leftMotor.setDirection(leftSpeed >= 0 ? ROTATE_BACKWARD : ROTATE_FORWARD);
-        leftMotor.setSpeed(abs(leftSpeed));
+        if (core.fallen) blackBox.freeze(BLACKBOX_FALL);
+        METRICS_RECORD(metrics, METRIC_RECORD, recordStart);
 
-        rightMotor.setDirection(rightSpeed >= 0 ? ROTATE_FORWARD : ROTATE_BACKWARD);
-        rightMotor.setSpeed(abs(rightSpeed));
+        METRICS_RECORD(metrics, METRIC_TICK, tickStart);
 
         }
 
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+
+
+// =========================================================
+//  Кільцевий буфер без блокувань: один виробник, один споживач
+//  Виробник (контур керування) ніколи не чекає — якщо місця немає,
+//  push() повертає false і запис відкидається
+//  N — степінь двійки
+// =========================================================
+
+template <typename T, size_t N>
+class Spsc_RingBuffer {
+
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+private:
+
+    T slots[N];
+    std::atomic<uint32_t> head;   // пише лише виробник
+    std::atomic<uint32_t> tail;   // пише лише споживач
+
+public:
+
+    Spsc_RingBuffer() : head(0), tail(0) {}
+
+    // === Виробник ===
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) return false;
+        slots[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Запис на місці: reserve() -> заповнити -> commit()
+    T* reserve() {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) return nullptr;
+        return &slots[h & (N - 1)];
+    }
+    void commit() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // === Споживач ===
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t) return false;
+        item = slots[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool   empty()    const { return size() == 0; }
+    size_t capacity() const { return N; }
+
+};
@@ -0,0 +1,161 @@
+#pragma once
+#include <Arduino.h>
+
+
+
+// =========================================================
+//  Замкнений контур кутової швидкості (yaw rate)
+//
+//  Вхід:  бажана кутова швидкість повороту (°/с, + = вправо)
+//         gyroZ з MPU6050 (°/с) і, за бажанням, різниця кроків коліс
+//  Вихід: steerOffset (кр/с), який RobotController додає до
+//         baseSpeed лівого колеса і віднімає від правого
+// =========================================================
+
+class SteeringController {
+
+private:
+
+    // === Коефіцієнти ===
+    float Kp;
+    float Ki;
+
+    // === Стан ===
+    float targetRate;      // °/с
+    float measuredRate;    // °/с (після фільтра / злиття)
+    float rateIntegral;    // Σ Ki·e·dt, °/с — зміна Ki не стрибає виходом
+    float steerOffset;     // кр/с
+
+    // === Параметри ===
+    float maxSteer;        // кр/с
+    float maxRate;         // °/с при steer = 0 / 100
+    float gyroSign;        // знак осі Z залежно від монтажу плати (RobotConfig)
+    float gyroAlpha;       // НЧ-фільтр гіроскопа (1.0 = без фільтра)
+    float gyroWeight;      // 1.0 = лише гіроскоп, 0.0 = лише колеса
+
+    // Скільки °/с повороту дає 1 кр/с диференціалу між колесами
+    float degPerStepRate;
+
+    // === Колеса ===
+    long lastLeftPos;
+    long lastRightPos;
+
+    // === Таймінги ===
+    unsigned long lastMs;
+
+    bool enabled;
+
+public:
+
+    // === Конструктор ===
+    SteeringController()
+        : Kp(0.0f), Ki(0.0f)
+        , targetRate(0), measuredRate(0), rateIntegral(0), steerOffset(0)
+        , maxSteer(2000.0f), maxRate(0.0f)
+        , gyroSign(-1.0f), gyroAlpha(0.5f), gyroWeight(1.0f)
+        , degPerStepRate(0.0f)
+        , lastLeftPos(0), lastRightPos(0)
+        , lastMs(0)
+        , enabled(false)
+    {
+        setGeometry(65.0f, 180.0f, 3200.0f);
+        setPI(1.0f, 2.0f);
+    }
+
+    // === Ініціалізація ===
+    void begin(long leftPos, long rightPos) { begin(leftPos, rightPos, millis()); }
+
+    void begin(long leftPos, long rightPos, unsigned long now) {
+        lastMs       = now;
+        lastLeftPos  = leftPos;
+        lastRightPos = rightPos;
+    }
+
+    // === Геометрія: діаметр колеса, колія (мм), кроків на оберт ===
+    // yaw [рад/с] = 2 * steer * (π·D / stepsPerRev) / track
+    void setGeometry(float wheelDiameterMm, float trackWidthMm, float stepsPerRev) {
+        float stepLenMm = PI * wheelDiameterMm / stepsPerRev;
+        degPerStepRate  = 2.0f * stepLenMm / trackWidthMm * RAD_TO_DEG;
+        maxRate         = maxSteer * degPerStepRate;
+    }
+
+    // Позиції: лівий мотор змонтований дзеркально, тому
+    // "вперед" для нього — це зменшення currentPosition
+    void update(float gyroZ, long leftPos, long rightPos) {
+        update(gyroZ, leftPos, rightPos, millis());
+    }
+
+    void update(float gyroZ, long leftPos, long rightPos, unsigned long now) {
+        float dt = (now - lastMs) / 1000.0f;
+        lastMs = now;
+
+        long dLeft  = leftPos  - lastLeftPos;
+        long dRight = rightPos - lastRightPos;
+        lastLeftPos  = leftPos;
+        lastRightPos = rightPos;
+
+        if (!enabled || dt <= 0.0f) {
+            rateIntegral = 0;
+            steerOffset  = 0;
+            return;
+        }
+
+        // --- Вимірювання ---
+        float gyroRate = gyroSign * gyroZ;
+        if (gyroWeight < 1.0f) {
+            // (ліве вперед - праве вперед) / 2, кр/с
+            float wheelSteer = (-dLeft - dRight) * 0.5f / dt;
+            gyroRate = gyroWeight * gyroRate
+                     + (1.0f - gyroWeight) * wheelSteer * degPerStepRate;
+        }
+        measuredRate += gyroAlpha * (gyroRate - measuredRate);
+
+        // --- PI + прямий зв'язок ---
+        float error = targetRate - measuredRate;
+
+        rateIntegral += Ki * error * dt;
+        rateIntegral  = constrain(rateIntegral, -maxRate, maxRate);
+
+        float rateCmd = targetRate + Kp * error + rateIntegral;
+
+        steerOffset = constrain(rateCmd / degPerStepRate, -maxSteer, maxSteer);
+    }
+
+    // steer: 0 = макс. вліво, 50 = прямо, 100 = макс. вправо
+    void setSteer(uint8_t steer) {
+        targetRate = (steer - 50) / 50.0f * maxRate;
+    }
+
+    void setTargetRate(float rate) {
+        targetRate = constrain(rate, -maxRate, maxRate);
+    }
+
+    void setEnabled(bool en) {
+        enabled = en;
+        if (!en) {
+            rateIntegral = 0;
+            measuredRate = 0;
+            steerOffset  = 0;
+        }
+    }
+
+    void setPI(float kp, float ki)   { Kp = kp; Ki = ki; rateIntegral = 0; }
+
+    // Зміна на ходу: накопичена I-складова лишається
+    void setGains(float kp, float ki) { Kp = kp; Ki = ki; }
+    void setGyroSign(float sign)     { gyroSign = (sign < 0) ? -1.0f : 1.0f; }
+    void setGyroFilter(float alpha)  { gyroAlpha = constrain(alpha, 0.01f, 1.0f); }
+    void setGyroWeight(float w)      { gyroWeight = constrain(w, 0.0f, 1.0f); }
+    void setMaxSteer(float steer) {
+        maxSteer = steer;
+        maxRate  = maxSteer * degPerStepRate;
+    }
+
+    // === Вихідні дані для RobotController ===
+    float getSteerOffset()  const { return steerOffset; }
+    float getTargetRate()   const { return targetRate; }
+    float getMeasuredRate() const { return measuredRate; }
+    float getMaxRate()      const { return maxRate; }
+    bool  isEnabled()       const { return enabled; }
+
+};
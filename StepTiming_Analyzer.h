@@ -0,0 +1,116 @@
+#pragma once
+#include <Arduino.h>
+
+
+
+// =========================================================
+//  Аналіз послідовності кроків: фактична vs ідеальна
+//
+//  Ідеальна послідовність — кроки з заданою швидкістю без затримок
+//  (інтеграл speed·dt по відрізках між командами setSpeed/setDirection).
+//  Фактична — кожен фронт STEP, який видав generateStep().
+//
+//  late     — інтервал довший за очікуваний більш ніж на половину
+//  missed   — скільки кроків ідеальна послідовність видала б за
+//             затримку понад один інтервал
+//  jitter   — СКВ запізнення фронту відносно очікуваного, мкс
+//  pulse    — STEP у HIGH довше за половину інтервалу (LOW-фаза
+//             коротша за HIGH — порушення для драйвера)
+//  position — фактична позиція мінус ідеальна, кроки
+// =========================================================
+
+class StepTiming_Analyzer {
+
+private:
+
+    uint32_t steps;
+    uint32_t lateSteps;
+    uint32_t missedSteps;
+    uint32_t maxLateMicros;
+    uint64_t jitterSumSq;
+    uint32_t jitterSamples;
+    uint32_t pulseViolations;
+    uint32_t maxPulseMicros;
+
+    uint32_t prevIntervalMicros;   // 0 — попереднього кроку не було (старт)
+
+    // === Ідеальна позиція ===
+    int32_t       producedSteps;   // зі знаком
+    double        idealSteps;      // зі знаком, до початку поточного відрізка;
+                                   // float втрачає крок після 2^24 (~28 хв на 10к кр/с)
+    unsigned long segStartMicros;
+    float         segSpeed;        // кр/с зі знаком
+
+    void closeSegment(unsigned long now) {
+        idealSteps    += segSpeed * (double)(now - segStartMicros) * 1e-6;
+        segStartMicros = now;
+    }
+
+public:
+
+    StepTiming_Analyzer() : segSpeed(0) { reset(0); }
+
+    // Обнулити статистику; ідеальна позиція — з поточною швидкістю від now
+    void reset(unsigned long now) {
+        steps = lateSteps = missedSteps = maxLateMicros = 0;
+        jitterSumSq = 0;
+        jitterSamples = 0;
+        pulseViolations = maxPulseMicros = 0;
+        prevIntervalMicros = 0;
+        producedSteps = 0;
+        idealSteps = 0;
+        segStartMicros = now;
+    }
+
+    // === generateStep() ===
+
+    // Кроки не генеруються (швидкість 0 або мотор вимкнено)
+    void onIdle() { prevIntervalMicros = 0; }
+
+    // Фронт HIGH. Очікуваний інтервал — більший з попереднього і поточного,
+    // щоб зміна швидкості між кроками не рахувалась як запізнення
+    void onStepRise(uint32_t elapsed, uint32_t interval) {
+        uint32_t expected = max(interval, prevIntervalMicros);
+        if (prevIntervalMicros != 0 && elapsed >= expected) {
+            uint32_t late = elapsed - expected;
+            jitterSumSq += (uint64_t)late * late;
+            jitterSamples++;
+            if (late > expected / 2)  lateSteps++;
+            if (late > maxLateMicros) maxLateMicros = late;
+            if (late >= expected)     missedSteps += late / expected;
+        }
+        prevIntervalMicros = interval;
+        steps++;
+    }
+
+    // Фронт LOW
+    void onStepFall(uint32_t width, uint32_t interval, bool forward) {
+        if (width > maxPulseMicros) maxPulseMicros = width;
+        if (width > interval / 2)   pulseViolations++;
+        producedSteps += forward ? 1 : -1;
+    }
+
+    // === Команди: setSpeed / setDirection / setMotorEnable ===
+    void onCommand(unsigned long now, float signedSpeed) {
+        closeSegment(now);
+        segSpeed = signedSpeed;
+    }
+
+    // === Результати ===
+    uint32_t getSteps()           const { return steps; }
+    uint32_t getLateSteps()       const { return lateSteps; }
+    uint32_t getMissedSteps()     const { return missedSteps; }
+    uint32_t getMaxLateMicros()   const { return maxLateMicros; }
+    uint32_t getPulseViolations() const { return pulseViolations; }
+    uint32_t getMaxPulseMicros()  const { return maxPulseMicros; }
+
+    float getJitterRmsMicros() const {
+        return jitterSamples ? sqrtf((float)jitterSumSq / jitterSamples) : 0.0f;
+    }
+
+    double getPositionError(unsigned long now) const {
+        double ideal = idealSteps + segSpeed * (double)(now - segStartMicros) * 1e-6;
+        return producedSteps - ideal;
+    }
+
+};
@@ -2,19 +2,41 @@
 
 #include <Arduino.h>
 
+#include "FastGpio.h"
+
+// Вимірювання (LoopMetrics_Manager, лічильники кроків); 0 — не компілюються
+#ifndef ROBOT_METRICS
+#define ROBOT_METRICS 1
+#endif
+
+#if ROBOT_METRICS
+#include "StepTiming_Analyzer.h"
+#endif
+
 enum Direction {
     ROTATE_FORWARD = HIGH,   
     ROTATE_BACKWARD = LOW    
 };
 
+// Що треба зробити з піном STEP у цій ітерації
+enum StepEdge : uint8_t {
+    STEP_EDGE_NONE = 0,
+    STEP_EDGE_RISE,
+    STEP_EDGE_FALL
+};
+
+// Піни — параметри шаблону: фронти STEP/DIR/EN компілюються
+// в один запис регістра (FastGpio.h)
+template <uint8_t STEP_PIN, uint8_t DIR_PIN, uint8_t EN_PIN>
 class StepperMotor_Controller {
 
-private:
+public:
 
-    uint8_t stepPin;        
-    uint8_t directionPin;  
-    uint8_t enablePin;      
-    uint8_t ledcChannel;
+    typedef FastPin<STEP_PIN> StepPin;
+    typedef FastPin<DIR_PIN>  DirPin;
+    typedef FastPin<EN_PIN>   EnablePin;
+
+private:
 
     bool isMotorEnabled;       
     Direction currentDirection; 
@@ -30,45 +52,16 @@ private:
     static constexpr unsigned long PULSE_WIDTH_MICROS = 2;  
     
     static constexpr float MIN_SPEED = 200.0f;  
-    
-    void generateStep() {
-        if (stepIntervalMicros == 0 || !isMotorEnabled) {
-            pulseState = false;
-            return;
-        }
-
-        unsigned long currentTime = micros();
-        
-        if (pulseState) {
-            if (currentTime - pulseStartMicros >= PULSE_WIDTH_MICROS) {
-                digitalWrite(stepPin, LOW);
-                pulseState = false;
-
-                if (currentDirection == ROTATE_FORWARD) {
-                    currentPosition++;
-                } else {
-                    currentPosition--;
-                }
-            }
-            return;
-        }
-        
-        // Перевірка overflow
-        unsigned long elapsed;
-        if (currentTime >= lastStepTimeMicros) {
-            elapsed = currentTime - lastStepTimeMicros;
-        } else {
-            elapsed = (0xFFFFFFFF - lastStepTimeMicros) + currentTime + 1;
-        }
 
+#if ROBOT_METRICS
+    // === Статистика кроків: фактична послідовність vs ідеальна ===
+    StepTiming_Analyzer timing;
 
-        if (elapsed >= stepIntervalMicros) {
-            digitalWrite(stepPin, HIGH);
-            pulseState = true;
-            pulseStartMicros = currentTime;
-            lastStepTimeMicros = currentTime;
-        }
+    void timingCommand() {
+        float speed = isMotorEnabled ? currentSpeed : 0.0f;
+        timing.onCommand(micros(), currentDirection == ROTATE_FORWARD ? speed : -speed);
     }
+#endif
 
     void updateStepInterval() {
         if (currentSpeed > 0) {
@@ -80,16 +73,7 @@ private:
 
 public:
 
-    StepperMotor_Controller(
-        uint8_t step_pin,
-        uint8_t direction_pin,
-        uint8_t enable_pin,
-        uint8_t ledc_channel
-    ) :
-        stepPin(step_pin),
-        directionPin(direction_pin),
-        enablePin(enable_pin),
-        ledcChannel(ledc_channel),
+    StepperMotor_Controller() :
         isMotorEnabled(false),
         currentDirection(ROTATE_FORWARD),
         currentSpeed(0),
@@ -101,20 +85,23 @@ public:
     {}
 
     void begin() {
-        pinMode(stepPin, OUTPUT);
-        pinMode(directionPin, OUTPUT);
-        pinMode(enablePin, OUTPUT);
+        StepPin::output();
+        DirPin::output();
+        EnablePin::output();
 
-        digitalWrite(stepPin, LOW);
-        digitalWrite(directionPin, ROTATE_FORWARD);
-        digitalWrite(enablePin, HIGH);
+        StepPin::low();
+        DirPin::write(ROTATE_FORWARD);
+        EnablePin::high();
         
         isMotorEnabled = false;
     }
 
     void setMotorEnable(bool enable) {
-        digitalWrite(enablePin, enable ? LOW : HIGH);
+        EnablePin::write(!enable);
         isMotorEnabled = enable;
+#if ROBOT_METRICS
+        timingCommand();
+#endif
     }
 
     bool isEnabled() const {
@@ -134,15 +121,78 @@ public:
         }
         
         updateStepInterval();
+#if ROBOT_METRICS
+        timingCommand();
+#endif
     }
 
     void setDirection(Direction direction) {
+        if (direction == currentDirection) return;
         currentDirection = direction;
-        digitalWrite(directionPin, direction);
+        DirPin::write(direction);
+#if ROBOT_METRICS
+        timingCommand();
+#endif
+    }
+
+    // Стан кроку на момент currentTime: оновлює позицію і таймінги,
+    // повертає фронт, який треба видати на STEP. Пін не чіпає —
+    // це робить run() або runSteppers() для обох моторів разом
+    StepEdge pollStep(unsigned long currentTime) {
+        if (stepIntervalMicros == 0 || !isMotorEnabled) {
+            bool wasHigh = pulseState;
+            pulseState = false;
+#if ROBOT_METRICS
+            timing.onIdle();
+#endif
+            return wasHigh ? STEP_EDGE_FALL : STEP_EDGE_NONE;
+        }
+
+        if (pulseState) {
+            if (currentTime - pulseStartMicros >= PULSE_WIDTH_MICROS) {
+                pulseState = false;
+#if ROBOT_METRICS
+                timing.onStepFall(currentTime - pulseStartMicros, stepIntervalMicros,
+                                  currentDirection == ROTATE_FORWARD);
+#endif
+
+                if (currentDirection == ROTATE_FORWARD) {
+                    currentPosition++;
+                } else {
+                    currentPosition--;
+                }
+                return STEP_EDGE_FALL;
+            }
+            return STEP_EDGE_NONE;
+        }
+        
+        // Перевірка overflow
+        unsigned long elapsed;
+        if (currentTime >= lastStepTimeMicros) {
+            elapsed = currentTime - lastStepTimeMicros;
+        } else {
+            elapsed = (0xFFFFFFFF - lastStepTimeMicros) + currentTime + 1;
+        }
+
+
+        if (elapsed >= stepIntervalMicros) {
+#if ROBOT_METRICS
+            timing.onStepRise(elapsed, stepIntervalMicros);
+#endif
+            pulseState = true;
+            pulseStartMicros = currentTime;
+            lastStepTimeMicros = currentTime;
+            return STEP_EDGE_RISE;
+        }
+        return STEP_EDGE_NONE;
     }
 
     void run() {
-        generateStep();
+        switch (pollStep(micros())) {
+            case STEP_EDGE_RISE: StepPin::high(); break;
+            case STEP_EDGE_FALL: StepPin::low();  break;
+            default: break;
+        }
     }
 
     float getSpeed() const {
@@ -165,4 +215,25 @@ public:
         return currentSpeed > 0;
     }
 
-};
\ No newline at end of file
+#if ROBOT_METRICS
+    StepTiming_Analyzer& getTiming() { return timing; }
+#endif
+
+};
+
+
+// Обидва мотори: одне читання micros() і один запис регістра на фронт,
+// якщо STEP-піни в одному банку (33 і 32 — обидва у верхньому)
+template <typename MotorA, typename MotorB>
+inline void runSteppers(MotorA& a, MotorB& b) {
+    unsigned long now = micros();
+    StepEdge ea = a.pollStep(now);
+    StepEdge eb = b.pollStep(now);
+    if (ea == STEP_EDGE_NONE && eb == STEP_EDGE_NONE) return;
+
+    const FastGpio::Masks none = { 0, 0 };
+    FastGpio::set(FastGpio::merge(ea == STEP_EDGE_RISE ? MotorA::StepPin::masks() : none,
+                                  eb == STEP_EDGE_RISE ? MotorB::StepPin::masks() : none));
+    FastGpio::clear(FastGpio::merge(ea == STEP_EDGE_FALL ? MotorA::StepPin::masks() : none,
+                                    eb == STEP_EDGE_FALL ? MotorB::StepPin::masks() : none));
+}
@@ -0,0 +1,197 @@
+#pragma once
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+
+#include "BinaryLog_Format.h"
+#include "Spsc_RingBuffer.h"
+#include "WebRequest_Helpers.h"
+
+
+
+// =========================================================
+//  Бінарний запис телеметрії (little-endian, 48 байт)
+//  Заміна текстових кадрів з LOGS: ~1 КБ UTF-8 -> 48 байт
+// =========================================================
+
+struct __attribute__((packed)) TelemetryRecord {
+    uint32_t timeMs;
+    uint16_t seq;
+    uint16_t tickUs;          // тривалість такту керування
+    uint16_t periodUs;        // інтервал між тактами
+    uint8_t  flags;           // TelemetryFlags
+    uint8_t  reserved;
+    float    pitch;
+    float    roll;
+    float    targetAngle;
+    float    baseSpeed;
+    float    estimatedSpeed;
+    float    leftSpeed;       // кр/с зі знаком, як задано мотору
+    float    rightSpeed;
+    int32_t  leftPosition;
+    int32_t  rightPosition;
+};
+
+static_assert(sizeof(TelemetryRecord) == 48, "TelemetryRecord layout changed");
+
+// Заголовок кожного WebSocket-повідомлення, далі count записів
+struct __attribute__((packed)) TelemetryBatchHeader {
+    uint8_t  version;
+    uint8_t  recordSize;
+    uint16_t count;
+    uint32_t dropped;
+};
+
+
+// =========================================================
+//  Потік телеметрії: контур керування -> кільцевий буфер ->
+//  WebSocket /telemetry
+//  AsyncWebSocket не потокобезпечний, тому відправка — лише з
+//  контексту AsyncTCP: сторінка шле текстове "p" (pull), обробник
+//  WS_EVT_DATA спорожнює буфер і викликає binaryAll/cleanupClients
+// =========================================================
+
+class Telemetry_Stream {
+
+public:
+
+    static constexpr uint8_t  VERSION        = 1;
+    static constexpr size_t   RING_SIZE      = 128;
+    static constexpr size_t   BATCH_RECORDS  = 16;
+    static constexpr uint32_t CLEANUP_PERIOD_MS = 1000;
+
+private:
+
+    AsyncWebServer* server;
+    AsyncWebSocket  ws;
+
+    Spsc_RingBuffer<TelemetryRecord, RING_SIZE> ring;
+
+    volatile uint16_t decimation;   // 1 = кожен такт
+    uint16_t decimCounter;
+    uint16_t seq;
+
+    volatile uint32_t dropped;      // ring переповнений (пише лише виробник)
+    volatile uint32_t unsent;       // клієнти не встигають (пише лише споживач)
+    volatile uint32_t sent;
+
+    // Клієнти WebSocket; без них виробник не пише в буфер
+    volatile uint8_t  listeners;
+    uint32_t lastCleanupMs;
+
+    uint8_t batch[sizeof(TelemetryBatchHeader) + BATCH_RECORDS * sizeof(TelemetryRecord)];
+
+    // Події WebSocket — контекст AsyncTCP; єдиний споживач буфера
+    void onEvent(AwsEventType type, void* arg, uint8_t* data, size_t len) {
+        switch (type) {
+            case WS_EVT_CONNECT:
+                listeners++;
+                break;
+            case WS_EVT_DISCONNECT:
+                if (listeners) listeners--;
+                break;
+            case WS_EVT_DATA: {
+                const AwsFrameInfo* info = static_cast<const AwsFrameInfo*>(arg);
+                if (info->final && info->index == 0 && info->len == len
+                        && info->opcode == WS_TEXT && len == 1 && data[0] == 'p') {
+                    pull();
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    void pull() {
+        drain();
+        uint32_t now = millis();
+        if (now - lastCleanupMs > CLEANUP_PERIOD_MS) {
+            ws.cleanupClients();
+            lastCleanupMs = now;
+        }
+    }
+
+    void drain() {
+        TelemetryBatchHeader* hdr = reinterpret_cast<TelemetryBatchHeader*>(batch);
+        TelemetryRecord* records  = reinterpret_cast<TelemetryRecord*>(batch + sizeof(TelemetryBatchHeader));
+
+        while (!ring.empty()) {
+            uint16_t n = 0;
+            while (n < BATCH_RECORDS && ring.pop(records[n])) n++;
+            if (n == 0) break;
+
+            // Без клієнтів просто спорожнюємо буфер
+            if (ws.count() == 0) continue;
+
+            hdr->version    = VERSION;
+            hdr->recordSize = sizeof(TelemetryRecord);
+            hdr->count      = n;
+            hdr->dropped    = dropped + unsent;
+
+            if (ws.availableForWriteAll()) {
+                ws.binaryAll(batch, sizeof(TelemetryBatchHeader) + n * sizeof(TelemetryRecord));
+                sent += n;
+            } else {
+                unsent += n;
+            }
+        }
+    }
+
+public:
+
+    Telemetry_Stream(AsyncWebServer* server)
+        : server(server), ws("/telemetry")
+        , decimation(5), decimCounter(0), seq(0)
+        , dropped(0), unsent(0), sent(0)
+        , listeners(0), lastCleanupMs(0)
+    {}
+
+    void begin() {
+        ws.onEvent([this](AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType type,
+                          void* arg, uint8_t* data, size_t len) {
+            onEvent(type, arg, data, len);
+        });
+        server->addHandler(&ws);
+
+        // telemetry/config?decim=N — кожен N-й такт (100 Гц / N)
+        server->on("/telemetry/config", HTTP_GET, [this](AsyncWebServerRequest *req) {
+            long decim;
+            if (WebRequest::intParam(req, "decim", decim)) {
+                setDecimation(decim);
+            }
+            char body[128];
+            snprintf(body, sizeof(body),
+                     "{\"decim\":%u,\"clients\":%u,\"sent\":%lu,\"dropped\":%lu,\"unsent\":%lu,\"queued\":%u}",
+                     (unsigned)decimation, (unsigned)ws.count(), (unsigned long)sent,
+                     (unsigned long)dropped, (unsigned long)unsent, (unsigned)ring.size());
+            WebRequest::sendBuffer(req, WebRequest::appJson(), body);
+        });
+    }
+
+    void setDecimation(long n) { decimation = constrain(n, 1L, 1000L); }
+
+    // === Виробник: викликається з такту керування, ніколи не блокує ===
+    // Повертає слот для заповнення або nullptr (немає клієнтів / децимація / переповнення)
+    TelemetryRecord* beginRecord() {
+        if (!listeners) return nullptr;
+        if (++decimCounter < decimation) return nullptr;
+        decimCounter = 0;
+
+        TelemetryRecord* r = ring.reserve();
+        if (!r) {
+            dropped++;
+            return nullptr;
+        }
+        r->seq = seq++;
+        r->reserved = 0;
+        return r;
+    }
+
+    void commitRecord() { ring.commit(); }
+
+    uint32_t getDropped() const { return dropped; }
+    uint32_t getUnsent()  const { return unsent; }
+    uint32_t getSent()    const { return sent; }
+
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "ControlPage_Command.h"
+
+
+
+// ═══════════════════════════════════════════════════════
+//  РОЗБІР ЗАПИТУ І ВІДПОВІДІ БЕЗ АЛОКАЦІЙ
+//  hasParam()/getParam() приймають const String& — кожен виклик
+//  з літералом створює тимчасовий String. Проходимо параметри
+//  за індексом і порівнюємо C-рядки.
+//  Спільне для всіх маршрутів: ControlPage_Router, телеметрія,
+//  бінарний лог, чорна скринька, метрики
+// ═══════════════════════════════════════════════════════
+
+namespace WebRequest {
+
+    inline const char* findParam(AsyncWebServerRequest *req, const char* name) {
+        size_t n = req->params();
+        for (size_t i = 0; i < n; i++) {
+            const AsyncWebParameter* p = req->getParam(i);
+            if (!p->isPost() && !p->isFile() && strcmp(p->name().c_str(), name) == 0) {
+                return p->value().c_str();
+            }
+        }
+        return nullptr;
+    }
+
+    // Пошук заголовка за індексом (getHeader(const String&) створює String)
+    inline const AsyncWebHeader* findHeader(AsyncWebServerRequest *req, const char* name) {
+        size_t n = req->headers();
+        for (size_t i = 0; i < n; i++) {
+            const AsyncWebHeader* h = req->getHeader(i);
+            if (strcasecmp(h->name().c_str(), name) == 0) return h;
+        }
+        return nullptr;
+    }
+
+    inline bool intParam(AsyncWebServerRequest *req, const char* name, long& out) {
+        return ControlParse::parseLong(findParam(req, name), out);
+    }
+
+    // === Відповіді ===
+    // Типи вмісту створюються один раз; сталі тексти віддаються з flash
+    // через send_P, тож обробник не будує жодного String
+    inline const String& textPlain() { static const String ct("text/plain");       return ct; }
+    inline const String& appJson()   { static const String ct("application/json"); return ct; }
+    inline const String& textHtml()  { static const String ct("text/html; charset=utf-8"); return ct; }
+    inline const String& appOctet()  { static const String ct("application/octet-stream"); return ct; }
+
+    // text — рядок у PROGMEM (static const char[] PROGMEM)
+    inline void sendText_P(AsyncWebServerRequest *req, int code, PGM_P text) {
+        req->send_P(code, textPlain(), text);
+    }
+
+    inline void sendOK(AsyncWebServerRequest *req) {
+        static const char OK_BODY[] PROGMEM = "OK";
+        sendText_P(req, 200, OK_BODY);
+    }
+
+    // Динамічне тіло зі стекового буфера: єдина копія — у саму відповідь
+    inline void sendBuffer(AsyncWebServerRequest *req, const String& type, const char* body, int code = 200) {
+        req->send(code, type, body);
+    }
+
+}
@@ -0,0 +1,144 @@
+// Гарячі шляхи контролера: баланс, генерація кроків, setSpeed, розбір /move
+//
+//   host_bench --benchmark_format=json           — машиночитний вивід
+//   host/bench/compare.py                        — порівняння з baseline.json
+
+#include <benchmark/benchmark.h>
+
+#include "BalancePID_Manager.h"
+#include "SteperMotor_Controller.h"
+#include "ControlPage_Routes.h"
+
+
+// Опорна робота фіксованої вартості: compare.py ділить на неї решту
+// результатів, тож порівняння не залежить від швидкості машини
+static void BM_Reference(benchmark::State& state) {
+    uint32_t x = 1;
+    for (auto _ : state) {
+        for (int i = 0; i < 64; i++) x = x * 1664525u + 1013904223u;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_Reference);
+
+
+static void BM_BalanceUpdate(benchmark::State& state) {
+    BalanceController b;
+    b.setInnerPID(600, 5000, 15);
+    b.setOuterPID(3);
+    b.begin(0);
+    b.setEnabled(true);
+    unsigned long now = 0;
+    float pitch = 0.5f;
+    for (auto _ : state) {
+        now += 10;
+        pitch = -pitch;
+        b.update(pitch, now);
+        benchmark::DoNotOptimize(b.getBaseSpeed());
+    }
+}
+BENCHMARK(BM_BalanceUpdate);
+
+
+typedef StepperMotor_Controller<33, 14, 26> BenchMotor;
+
+// pollStep у кожній ітерації loop(): здебільшого "ще не час"
+static void BM_PollStep(benchmark::State& state) {
+    BenchMotor m;
+    m.begin();
+    m.setMotorEnable(true);
+    m.setSpeed(10000);
+    unsigned long now = 0;
+    for (auto _ : state) {
+        now += 7;
+        benchmark::DoNotOptimize(m.pollStep(now));
+    }
+}
+BENCHMARK(BM_PollStep);
+
+// Колишній generateStep(): pollStep + запис фронту в регістр
+static void BM_GenerateStep(benchmark::State& state) {
+    HostClock::setManual(true, 0);
+    BenchMotor m;
+    m.begin();
+    m.setMotorEnable(true);
+    m.setSpeed(50000);
+    for (auto _ : state) {
+        HostClock::advanceMicros(10);
+        m.run();
+    }
+    HostClock::setManual(false);
+}
+BENCHMARK(BM_GenerateStep);
+
+static void BM_SetSpeed(benchmark::State& state) {
+    BenchMotor m;
+    m.begin();
+    m.setMotorEnable(true);
+    float speed = 100.0f;
+    for (auto _ : state) {
+        speed = speed > 40000.0f ? 100.0f : speed * 1.01f;
+        m.setSpeed(speed);
+        benchmark::DoNotOptimize(m.getSpeed());
+    }
+}
+BENCHMARK(BM_SetSpeed);
+
+
+static void BM_ParseMove(benchmark::State& state) {
+    ControlCommand cmd = { STOP, 150, 50 };
+    for (auto _ : state) {
+        ControlParse::applyMove(cmd, "1", "-1", "200");
+        benchmark::DoNotOptimize(cmd);
+    }
+}
+BENCHMARK(BM_ParseMove);
+
+// Повний обробник /move: пошук параметрів, розбір, статистика зв'язку, відповідь
+static void BM_RouteMove(benchmark::State& state) {
+    static const uint8_t page[] = { 0 };
+    AsyncWebServer server(80);
+    ControlPage_Router router(&server);
+    router.setupRoutes(ControlPage_Asset{ page, sizeof(page), "\"x\"" });
+    AsyncWebServerRequest req("/move?v=1&h=0&s=180&n=1");
+    for (auto _ : state) {
+        server.handle(req);
+        benchmark::DoNotOptimize(router.getCommand());
+    }
+}
+BENCHMARK(BM_RouteMove);
+
+
+// Вартість одного фронту STEP для обох моторів: кожен виклик видає фронт
+// (HIGH кожні 20 мкс, LOW на наступному). PerMotor — два run(), Merged — runSteppers()
+static void stepEdgeLoop(benchmark::State& state, bool merged) {
+    HostClock::setManual(true, 0);
+    typedef StepperMotor_Controller<32, 25, 27> BenchRight;
+    BenchMotor a;
+    BenchRight b;
+    a.begin();
+    b.begin();
+    a.setMotorEnable(true);
+    b.setMotorEnable(true);
+    a.setSpeed(50000);
+    b.setSpeed(50000);
+    bool rise = true;
+    for (auto _ : state) {
+        HostClock::advanceMicros(rise ? 18 : 2);
+        rise = !rise;
+        if (merged) {
+            runSteppers(a, b);
+        } else {
+            a.run();
+            b.run();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    HostClock::setManual(false);
+}
+
+static void BM_StepEdgePerMotor(benchmark::State& state) { stepEdgeLoop(state, false); }
+BENCHMARK(BM_StepEdgePerMotor);
+
+static void BM_StepEdgeMerged(benchmark::State& state)   { stepEdgeLoop(state, true); }
+BENCHMARK(BM_StepEdgeMerged);
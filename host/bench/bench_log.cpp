@@ -0,0 +1,63 @@
+// DeferredLog_Manager::write() під потоком повідомлень: форматування в
+// кільце, відкидання при повному кільці і відсікання обмежувачем частоти
+
+#include <benchmark/benchmark.h>
+
+#include "DeferredLog_Manager.h"
+
+static const char FLOOD_TEXT[] = "balance: pitch=%+6.2f speed=%+6d loop=%4u us";
+
+// Ручний час: millis() без системного виклику, вікно обмежувача стоїть
+struct ManualClock {
+    ManualClock()  { HostClock::setManual(true, 1000000); }
+    ~ManualClock() { HostClock::setManual(false); }
+};
+
+// Порожнє кільце без фонового завдання: RING_SIZE повідомлень лягають
+// у кільце, ще стільки ж — відкидаються. Один прохід — 2·RING_SIZE викликів
+static void BM_LogFlood(benchmark::State& state) {
+    const int calls = 2 * DeferredLog_Manager::RING_SIZE;
+    LogRateLimit sites[calls];
+    uint32_t dropped = 0;
+    ManualClock clock;
+    for (auto _ : state) {
+        DeferredLog_Manager log;
+        for (int i = 0; i < calls; i++) {
+            sites[i] = LogRateLimit();
+            log.write(LOG_LEVEL_WARN, sites[i], FLOOD_TEXT, i * 0.1, i * 10, 2500u);
+        }
+        dropped = log.getDropped();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * calls);
+    state.counters["dropped_per_pass"] = dropped;
+}
+BENCHMARK(BM_LogFlood);
+
+// Кільце повне: виклик лише рахує втрату
+static void BM_LogDropped(benchmark::State& state) {
+    ManualClock clock;
+    DeferredLog_Manager log;
+    LogRateLimit fill[DeferredLog_Manager::RING_SIZE];
+    for (LogRateLimit& rl : fill) log.write(LOG_LEVEL_WARN, rl, "fill");
+    for (auto _ : state) {
+        LogRateLimit rl;
+        log.write(LOG_LEVEL_WARN, rl, FLOOD_TEXT, 0.5, 10, 2500u);
+        benchmark::DoNotOptimize(rl);
+    }
+    state.counters["dropped"] = log.getDropped();
+}
+BENCHMARK(BM_LogDropped);
+
+// Одне місце виклику понад LOG_RATE_PER_SEC: відсікання до форматування
+static void BM_LogSuppressed(benchmark::State& state) {
+    ManualClock clock;
+    DeferredLog_Manager log;
+    LogRateLimit rl;
+    for (auto _ : state) {
+        log.write(LOG_LEVEL_WARN, rl, FLOOD_TEXT, 0.5, 10, 2500u);
+        benchmark::DoNotOptimize(rl);
+    }
+    state.counters["suppressed"] = log.getSuppressed();
+}
+BENCHMARK(BM_LogSuppressed);
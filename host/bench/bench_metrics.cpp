@@ -0,0 +1,61 @@
+// Вартість самих вимірювань (ROBOT_METRICS): пара METRICS_MARK/RECORD
+// на етап такту, кошик гістограми і статистика кроків у pollStep()
+
+#include <benchmark/benchmark.h>
+
+#include "LoopMetrics_Manager.h"
+
+typedef StepperMotor_Controller<33, 14, 26> MetricsLeft;
+typedef StepperMotor_Controller<32, 25, 27> MetricsRight;
+
+// Один виміряний етап: два читання лічильника тактів + запис у гістограму.
+// run() робить таку пару на кожну ітерацію loop() і ще шість на такт
+static void BM_MetricsStage(benchmark::State& state) {
+    AsyncWebServer      server(80);
+    LoopMetrics_Manager metrics(&server);
+    MetricsLeft  left;
+    MetricsRight right;
+    metrics.begin(left, right);
+    for (auto _ : state) {
+        METRICS_MARK(start);
+        METRICS_RECORD(metrics, METRIC_PID, start);
+    }
+}
+BENCHMARK(BM_MetricsStage);
+
+// 64 значення за ітерацію. Лише гістограма — частина, яка на ESP32 коштує стільки ж, скільки тут
+// (ESP.getCycleCount() там — одна інструкція)
+static void BM_HistogramAdd(benchmark::State& state) {
+    CycleHistogram h;
+    h.reset();
+    uint32_t x = 12345;
+    for (auto _ : state) {
+        for (int i = 0; i < 64; i++) {
+            x = x * 1664525u + 1013904223u;
+            h.add(x >> 12);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+    benchmark::DoNotOptimize(h.total);
+}
+BENCHMARK(BM_HistogramAdd);
+
+// Статистика кроку в pollStep(): фронт HIGH + фронт LOW, 64 кроки за ітерацію
+static void BM_StepTimingPerStep(benchmark::State& state) {
+    StepTiming_Analyzer t;
+    t.onCommand(0, 10000);
+    uint32_t jitter = 0;
+    benchmark::DoNotOptimize(&t);
+    for (auto _ : state) {
+        for (int i = 0; i < 64; i++) {
+            jitter = (jitter + 3) & 7;
+            t.onStepRise(100 + jitter, 100);
+            t.onStepFall(2, 100, true);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+    benchmark::DoNotOptimize(t.getSteps());
+}
+BENCHMARK(BM_StepTimingPerStep);
@@ -0,0 +1,30 @@
+// Симуляція loop() з затримками (host/sim/StepLoop_Sim.h): вартість
+// прогону і втрачені кроки — опорна точка для інших бекендів кроків
+
+#include <benchmark/benchmark.h>
+
+#include "StepLoop_Sim.h"
+
+typedef StepperMotor_Controller<33, 14, 26> SimLeft;
+typedef StepperMotor_Controller<32, 25, 27> SimRight;
+
+// 100 мс на 10000 кр/с, прохід loop() 5 мкс, затримка 1 мс кожні 20 мс
+static void BM_StepStallSim(benchmark::State& state) {
+    int32_t error = 0;
+    for (auto _ : state) {
+        StepSim::Loop sim(5);
+        for (uint32_t t = 10000; t < 100000; t += 20000) sim.addStall(t, 1000);
+        SimLeft  left;
+        SimRight right;
+        left.begin();
+        right.begin();
+        left.setMotorEnable(true);
+        right.setMotorEnable(true);
+        left.setSpeed(10000);
+        right.setSpeed(10000);
+        sim.run(left, right, 100000);
+        error = sim.compare(33, 100).positionError;
+    }
+    state.counters["lost_steps"] = -error;
+}
+BENCHMARK(BM_StepStallSim);
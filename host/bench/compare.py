@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""
+Запускає host_bench, пише результат у JSON і порівнює з baseline.json.
+
+Час кожного бенчмарку ділиться на час BM_Reference з того самого запуску,
+тож базова лінія, знята на одній машині, придатна й на іншій.
+Регресія — відношення до базової лінії більше за --threshold.
+
+    compare.py --bench build/host_bench --baseline host/bench/baseline.json
+    compare.py ... --update        переписати базову лінію поточним запуском
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+
+REFERENCE = "BM_Reference"
+
+
+def run(bench, out, min_time, repetitions):
+    cmd = [bench,
+           "--benchmark_format=json",
+           "--benchmark_min_time=%g" % min_time,
+           "--benchmark_repetitions=%d" % repetitions,
+           "--benchmark_report_aggregates_only=true"]
+    res = subprocess.run(cmd, check=True, stdout=subprocess.PIPE, text=True)
+    with open(out, "w") as f:
+        f.write(res.stdout)
+    return json.loads(res.stdout)
+
+
+def normalised(report):
+    # Медіана повторів; без повторів — єдиний запуск
+    times = {}
+    for b in report["benchmarks"]:
+        if b.get("run_type") == "aggregate" and b.get("aggregate_name") != "median":
+            continue
+        times[b["run_name"]] = b["cpu_time"]
+    if REFERENCE not in times:
+        sys.exit("compare.py: %s missing from the report" % REFERENCE)
+    ref = times[REFERENCE]
+    return {name: t / ref for name, t in times.items() if name != REFERENCE}
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--bench", required=True)
+    ap.add_argument("--baseline", required=True)
+    ap.add_argument("--out", default="bench.json")
+    ap.add_argument("--threshold", type=float, default=1.5)
+    ap.add_argument("--min-time", type=float, default=0.05)
+    ap.add_argument("--repetitions", type=int, default=3)
+    ap.add_argument("--update", action="store_true")
+    args = ap.parse_args()
+
+    report = run(args.bench, args.out, args.min_time, args.repetitions)
+    current = normalised(report)
+
+    if args.update:
+        with open(args.baseline, "w") as f:
+            json.dump({"reference": REFERENCE, "relative": current}, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("baseline updated: %d benchmarks" % len(current))
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)["relative"]
+
+    failed = []
+    print("%-28s %10s %10s %7s" % ("benchmark", "baseline", "current", "ratio"))
+    for name in sorted(current):
+        if name not in baseline:
+            print("%-28s %10s %10.3f %7s" % (name, "-", current[name], "new"))
+            continue
+        ratio = current[name] / baseline[name]
+        mark = "  REGRESSION" if ratio > args.threshold else ""
+        print("%-28s %10.3f %10.3f %7.2f%s" % (name, baseline[name], current[name], ratio, mark))
+        if ratio > args.threshold:
+            failed.append(name)
+    for name in sorted(set(baseline) - set(current)):
+        print("%-28s missing from this run" % name)
+
+    if failed:
+        print("regressions over %.2fx: %s" % (args.threshold, ", ".join(failed)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,300 @@
+#pragma once
+
+// =========================================================
+//  Мінімальна заміна ядра Arduino-ESP32 для збірки на Linux
+//  Лише те, що використовують заголовки контролера
+//
+//  Час:      HostClock — реальний (за замовчуванням) або ручний,
+//            коли симуляція сама рухає час (advanceMicros / delay)
+//  Завдання: xTaskCreatePinnedToCore за замовчуванням не запускає
+//            нічого (детерміновані тести); HostTasks::setEnabled(true)
+//            запускає кожне завдання окремим потоком
+// =========================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <limits.h>
+#include <math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH   0x1
+#define LOW    0x0
+#define INPUT  0x01
+#define OUTPUT 0x03
+
+#define PROGMEM
+#define PGM_P     const char*
+#define IRAM_ATTR
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+
+#define PI         3.1415926535897932384626433832795
+#define HALF_PI    1.5707963267948966192313216916398
+#define TWO_PI     6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::abs;
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+
+// =========================================================
+//  Час
+// =========================================================
+
+namespace HostClock {
+    // manual = true: час стоїть, поки його не рушать advanceMicros()/delay()
+    void     setManual(bool manual, uint64_t startMicros = 0);
+    bool     isManual();
+    void     advanceMicros(uint64_t us);
+    uint64_t nowMicros();
+}
+
+// Як на ESP32: 32-бітні лічильники з переповненням
+inline unsigned long micros() { return (unsigned long)(uint32_t)HostClock::nowMicros(); }
+inline unsigned long millis() { return (unsigned long)(uint32_t)(HostClock::nowMicros() / 1000); }
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+
+// =========================================================
+//  Піни (digitalWrite оновлює ті самі регістри, що й FastGpio)
+// =========================================================
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int  digitalRead(uint8_t pin);
+
+
+// =========================================================
+//  FreeRTOS: завдання — потоки, тік — 1 мс
+// =========================================================
+
+typedef void*    TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdPASS             1
+#define pdFAIL             0
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+
+namespace HostTasks {
+    void   setEnabled(bool enabled);
+    size_t created();          // викликів xTaskCreatePinnedToCore
+    size_t running();          // з них запущено потоками
+}
+
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack,
+                                   void* arg, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+
+
+// =========================================================
+//  String: як в Arduino — кожен непорожній рядок у купі,
+//  тож тести бачать кожну тимчасову копію
+// =========================================================
+
+class String {
+
+private:
+
+    char*  buf;
+    size_t len;
+    size_t cap;
+
+    void assign(const char* s, size_t n);
+
+public:
+
+    String() : buf(nullptr), len(0), cap(0) {}
+    String(const char* s) : String() { if (s) assign(s, strlen(s)); }
+    String(const String& o) : String() { assign(o.c_str(), o.len); }
+    String(String&& o) noexcept : buf(o.buf), len(o.len), cap(o.cap) { o.buf = nullptr; o.len = o.cap = 0; }
+    explicit String(char c) : String() { assign(&c, 1); }
+    explicit String(int v);
+    explicit String(unsigned int v);
+    explicit String(long v);
+    explicit String(unsigned long v);
+    explicit String(float v, unsigned char decimals = 2);
+    explicit String(double v, unsigned char decimals = 2);
+    ~String() { delete[] buf; }
+
+    String& operator=(const String& o) { if (this != &o) assign(o.c_str(), o.len); return *this; }
+    String& operator=(const char* s)    { assign(s ? s : "", s ? strlen(s) : 0); return *this; }
+    String& operator=(String&& o) noexcept;
+
+    bool reserve(size_t size);
+
+    const char* c_str()  const { return buf ? buf : ""; }
+    size_t      length() const { return len; }
+    char operator[](size_t i) const { return i < len ? buf[i] : 0; }
+
+    long  toInt()   const { return atol(c_str()); }
+    float toFloat() const { return (float)atof(c_str()); }
+
+    bool equals(const char* s) const { return strcmp(c_str(), s ? s : "") == 0; }
+    bool equals(const String& s) const { return len == s.len && strcmp(c_str(), s.c_str()) == 0; }
+    bool equalsIgnoreCase(const String& s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+    bool startsWith(const String& s) const { return len >= s.len && strncmp(c_str(), s.c_str(), s.len) == 0; }
+    bool endsWith(const String& s) const { return len >= s.len && strcmp(c_str() + len - s.len, s.c_str()) == 0; }
+
+    bool operator==(const String& s) const { return equals(s); }
+    bool operator==(const char* s)   const { return equals(s); }
+    bool operator!=(const String& s) const { return !equals(s); }
+    bool operator!=(const char* s)   const { return !equals(s); }
+
+    String& concat(const char* s, size_t n);
+    String& operator+=(const String& s) { return concat(s.c_str(), s.len); }
+    String& operator+=(const char* s)   { return concat(s, strlen(s)); }
+    String& operator+=(char c)          { return concat(&c, 1); }
+
+    friend String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+    friend String operator+(const String& a, const char* b)   { String r(a); r += b; return r; }
+
+};
+
+
+// =========================================================
+//  Print / Serial
+// =========================================================
+
+class Print {
+
+public:
+
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t len) {
+        size_t n = 0;
+        while (len--) n += write(*data++);
+        return n;
+    }
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    virtual int availableForWrite() { return 0; }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    size_t print(const char* s)     { return write(s); }
+    size_t print(const String& s)   { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(char c)            { return write((uint8_t)c); }
+    size_t print(int v)             { return printf("%d", v); }
+    size_t print(unsigned int v)    { return printf("%u", v); }
+    size_t print(long v)            { return printf("%ld", v); }
+    size_t print(unsigned long v)   { return printf("%lu", v); }
+    size_t print(double v, int d = 2) { return printf("%.*f", d, v); }
+
+    size_t println()                { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v)      { size_t n = print(v); return n + println(); }
+
+};
+
+// UART: TX-буфер 128 байт, який спорожнюється зі швидкістю порту
+// (реальний час). write() блокує, як на ESP32, коли буфер повний.
+// Усе надіслане лишається в output() для перевірок
+class HardwareSerial : public Print {
+
+private:
+
+    mutable std::mutex lock;
+    std::string        sent;
+    unsigned long      baud;
+    double             txBytes;       // у TX-буфері на момент txStamp
+    uint64_t           txStamp;
+
+    void drainTx();
+
+public:
+
+    static constexpr size_t TX_BUFFER = 128;
+
+    HardwareSerial() : baud(0), txBytes(0), txStamp(0) {}
+
+    void begin(unsigned long baudRate) { std::lock_guard<std::mutex> g(lock); baud = baudRate; }
+    void end() {}
+
+    int    availableForWrite() override;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t len) override;
+    using Print::write;
+
+    // === Хост ===
+    std::string output() const { std::lock_guard<std::mutex> g(lock); return sent; }
+    void        clearOutput()  { std::lock_guard<std::mutex> g(lock); sent.clear(); }
+
+};
+
+extern HardwareSerial Serial;
+
+
+// =========================================================
+//  ESP: лічильник тактів — 240 МГц від монотонного годинника,
+//  щоб getCycleCount() / getCpuFreqMHz() давали мікросекунди
+// =========================================================
+
+class EspClass {
+
+public:
+
+    uint32_t freeHeap    = 200000;
+    uint32_t maxAllocHeap = 110000;
+    uint32_t minFreeHeap = 150000;
+
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFreeHeap()    { return freeHeap; }
+    uint32_t getMaxAllocHeap() { return maxAllocHeap; }
+    uint32_t getMinFreeHeap() { return minFreeHeap; }
+    void     restart() { abort(); }
+
+};
+
+extern EspClass ESP;
+
+
+// =========================================================
+//  IPAddress
+// =========================================================
+
+class IPAddress {
+
+private:
+
+    uint8_t bytes[4];
+
+public:
+
+    IPAddress() : bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    IPAddress(uint32_t v) { memcpy(bytes, &v, 4); }
+
+    operator uint32_t() const { uint32_t v; memcpy(&v, bytes, 4); return v; }
+    uint8_t  operator[](int i) const { return bytes[i]; }
+    uint8_t& operator[](int i)       { return bytes[i]; }
+
+};
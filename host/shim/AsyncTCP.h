@@ -0,0 +1,18 @@
+#pragma once
+
+// AsyncTCP на хості: лише адреса клієнта запиту
+
+#include <Arduino.h>
+
+class AsyncClient {
+
+public:
+
+    IPAddress ip;
+
+    AsyncClient() : ip(192, 168, 4, 2) {}
+    explicit AsyncClient(IPAddress ip) : ip(ip) {}
+
+    IPAddress remoteIP() const { return ip; }
+
+};
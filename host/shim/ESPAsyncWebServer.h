@@ -0,0 +1,506 @@
+#pragma once
+
+// =========================================================
+//  ESPAsyncWebServer на хості
+//
+//  AsyncWebServerRequest будується з URL ("/move?v=1&h=0") і
+//  передається в AsyncWebServer::handle(), який шукає маршрут так
+//  само, як AsyncCallbackWebHandler: точний шлях або шлях + "/...",
+//  перший зареєстрований виграє. Відповідь лишається в запиті
+//  (response()) — тести перевіряють код, заголовки й тіло.
+//
+//  Сховище відповіді виділяється разом із запитом, тож лічильник
+//  алокацій навколо обробника бачить лише алокації самого обробника
+//  (String-тимчасові, копії тіла), а не цієї заміни
+// =========================================================
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <WiFi.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef enum {
+    HTTP_GET    = 0b00000001,
+    HTTP_POST   = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT    = 0b00001000,
+    HTTP_ANY    = 0b01111111,
+} WebRequestMethod;
+
+
+class AsyncWebParameter {
+
+private:
+
+    String _name;
+    String _value;
+    bool   _isForm;
+    bool   _isFile;
+
+public:
+
+    AsyncWebParameter(const String& name, const String& value, bool form = false, bool file = false)
+        : _name(name), _value(value), _isForm(form), _isFile(file) {}
+
+    const String& name()   const { return _name; }
+    const String& value()  const { return _value; }
+    size_t        size()   const { return _value.length(); }
+    bool          isPost() const { return _isForm; }
+    bool          isFile() const { return _isFile; }
+
+};
+
+
+class AsyncWebHeader {
+
+private:
+
+    String _name;
+    String _value;
+
+public:
+
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+
+    const String& name()  const { return _name; }
+    const String& value() const { return _value; }
+
+};
+
+
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+
+class AsyncWebServerResponse {
+
+public:
+
+    static constexpr size_t MAX_HEADERS = 8;
+
+    struct Header {
+        char name[40];
+        char value[96];
+    };
+
+    int               code;
+    std::string       contentType;
+    std::string       content;         // звичайна відповідь і потік
+    const uint8_t*    progmem;         // beginResponse_P
+    size_t            progmemLength;
+    AwsResponseFiller filler;          // beginChunkedResponse
+    bool              chunked;
+    Header            headers[MAX_HEADERS];
+    size_t            headerCount;
+
+    AsyncWebServerResponse() {
+        content.reserve(16384);
+        contentType.reserve(64);
+        clear();
+    }
+    virtual ~AsyncWebServerResponse() {}
+
+    void clear() {
+        code = 0;
+        contentType.clear();
+        content.clear();
+        progmem = nullptr;
+        progmemLength = 0;
+        filler = nullptr;
+        chunked = false;
+        headerCount = 0;
+    }
+
+    void setCode(int c) { code = c; }
+
+    void addHeader(const String& name, const String& value) {
+        if (headerCount >= MAX_HEADERS) return;
+        Header& h = headers[headerCount++];
+        snprintf(h.name,  sizeof(h.name),  "%s", name.c_str());
+        snprintf(h.value, sizeof(h.value), "%s", value.c_str());
+    }
+
+    // === Хост ===
+    const char* header(const char* name) const {
+        for (size_t i = 0; i < headerCount; i++) {
+            if (strcasecmp(headers[i].name, name) == 0) return headers[i].value;
+        }
+        return nullptr;
+    }
+
+    // Тіло так, як його отримав би клієнт; filler викликається
+    // шматками по chunkSize, як це робить AsyncTCP
+    std::string body(size_t chunkSize = 1460) {
+        if (progmem) return std::string((const char*)progmem, progmemLength);
+        if (!filler) return content;
+        std::string out;
+        std::vector<uint8_t> buf(chunkSize);
+        for (;;) {
+            size_t n = filler(buf.data(), buf.size(), out.size());
+            if (n == 0) break;
+            out.append((const char*)buf.data(), n);
+        }
+        return out;
+    }
+
+};
+
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+
+public:
+
+    size_t write(uint8_t c) override { content.push_back((char)c); return 1; }
+    size_t write(const uint8_t* data, size_t len) override { content.append((const char*)data, len); return len; }
+    using Print::write;
+
+};
+
+
+class AsyncWebServerRequest {
+
+private:
+
+    String      _url;
+    AsyncClient _defaultClient;
+    AsyncClient* _client;
+
+    std::vector<std::unique_ptr<AsyncWebParameter>> _params;
+    std::vector<std::unique_ptr<AsyncWebHeader>>    _headers;
+
+    AsyncResponseStream     storage;
+    AsyncWebServerResponse* sent;
+    std::function<void()>   onDisc;
+
+    static String decode(const std::string& s) {
+        std::string out;
+        for (size_t i = 0; i < s.size(); i++) {
+            if (s[i] == '+') out += ' ';
+            else if (s[i] == '%' && i + 2 < s.size()) {
+                out += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+                i += 2;
+            }
+            else out += s[i];
+        }
+        return String(out.c_str());
+    }
+
+    AsyncWebServerResponse* prepare(int code, const String& contentType) {
+        storage.clear();
+        storage.code = code;
+        storage.contentType.assign(contentType.c_str(), contentType.length());
+        return &storage;
+    }
+
+public:
+
+    // "/path?a=1&b=2"
+    explicit AsyncWebServerRequest(const char* target, AsyncClient* client = nullptr)
+        : _client(client ? client : &_defaultClient), sent(nullptr)
+    {
+        std::string t = target;
+        size_t q = t.find('?');
+        _url = String(t.substr(0, q).c_str());
+        if (q == std::string::npos) return;
+
+        std::string query = t.substr(q + 1);
+        size_t start = 0;
+        while (start <= query.size()) {
+            size_t amp = query.find('&', start);
+            std::string pair = query.substr(start, amp == std::string::npos ? std::string::npos : amp - start);
+            if (!pair.empty()) {
+                size_t eq = pair.find('=');
+                std::string name  = pair.substr(0, eq);
+                std::string value = eq == std::string::npos ? "" : pair.substr(eq + 1);
+                _params.emplace_back(new AsyncWebParameter(decode(name), decode(value)));
+            }
+            if (amp == std::string::npos) break;
+            start = amp + 1;
+        }
+    }
+
+    AsyncWebServerRequest& header(const char* name, const char* value) {
+        _headers.emplace_back(new AsyncWebHeader(String(name), String(value)));
+        return *this;
+    }
+
+    const String& url()    const { return _url; }
+    AsyncClient*  client()       { return _client; }
+
+    // === Параметри ===
+    size_t params() const { return _params.size(); }
+    AsyncWebParameter* getParam(size_t i) const { return i < _params.size() ? _params[i].get() : nullptr; }
+
+    bool hasParam(const String& name, bool post = false, bool file = false) const {
+        return getParam(name, post, file) != nullptr;
+    }
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const {
+        for (const auto& p : _params) {
+            if (p->name() == name && p->isPost() == post && p->isFile() == file) return p.get();
+        }
+        return nullptr;
+    }
+
+    // === Заголовки ===
+    size_t headers() const { return _headers.size(); }
+    AsyncWebHeader* getHeader(size_t i) const { return i < _headers.size() ? _headers[i].get() : nullptr; }
+    bool hasHeader(const String& name) const { return getHeader(name) != nullptr; }
+    AsyncWebHeader* getHeader(const String& name) const {
+        for (const auto& h : _headers) {
+            if (h->name().equalsIgnoreCase(name)) return h.get();
+        }
+        return nullptr;
+    }
+
+    // === Відповіді ===
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String()) {
+        AsyncWebServerResponse* r = prepare(code, contentType);
+        r->content.assign(content.c_str(), content.length());
+        return r;
+    }
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t len) {
+        AsyncWebServerResponse* r = prepare(code, contentType);
+        r->progmem = content;
+        r->progmemLength = len;
+        return r;
+    }
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller filler) {
+        AsyncWebServerResponse* r = prepare(200, contentType);
+        r->filler  = std::move(filler);
+        r->chunked = true;
+        return r;
+    }
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460) {
+        (void)bufferSize;
+        prepare(200, contentType);
+        return &storage;
+    }
+
+    void send(AsyncWebServerResponse* response) { sent = response; }
+    void send(int code, const String& contentType = String(), const String& content = String()) {
+        send(beginResponse(code, contentType, content));
+    }
+    void send_P(int code, const String& contentType, const uint8_t* content, size_t len) {
+        send(beginResponse_P(code, contentType, content, len));
+    }
+    void send_P(int code, const String& contentType, PGM_P content) {
+        send(beginResponse_P(code, contentType, (const uint8_t*)content, strlen(content)));
+    }
+
+    void onDisconnect(std::function<void()> fn) { onDisc = std::move(fn); }
+
+    // === Хост ===
+    AsyncWebServerResponse* response() const { return sent; }
+    int         code() const { return sent ? sent->code : 0; }
+    std::string body()       { return sent ? sent->body() : std::string(); }
+    void        disconnect() { if (onDisc) onDisc(); onDisc = nullptr; }
+
+};
+
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+};
+
+
+// =========================================================
+//  WebSocket: клієнти й події — з потоку тесту, який тут грає
+//  роль завдання AsyncTCP. Виклики binaryAll / cleanupClients
+//  з іншого потоку рахуються в foreignCalls
+// =========================================================
+
+typedef enum {
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA,
+} AwsEventType;
+
+#define WS_CONTINUATION 0x00
+#define WS_TEXT         0x01
+#define WS_BINARY       0x02
+
+typedef struct {
+    uint8_t  message_opcode;
+    uint32_t num;
+    uint8_t  final;
+    uint8_t  masked;
+    uint8_t  opcode;
+    uint64_t len;
+    uint8_t  mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+
+private:
+
+    uint32_t _id;
+
+public:
+
+    std::vector<std::string> messages;     // усе надіслане цьому клієнту
+    bool queueFull = false;
+
+    explicit AsyncWebSocketClient(uint32_t id) : _id(id) {}
+
+    uint32_t id() const { return _id; }
+    bool canSend() const { return !queueFull; }
+    void binary(const uint8_t* data, size_t len) { if (!queueFull) messages.emplace_back((const char*)data, len); }
+    void text(const char* s) { if (!queueFull) messages.emplace_back(s); }
+
+};
+
+class AsyncWebSocket : public AsyncWebHandler {
+
+public:
+
+    typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)> AwsEventHandler;
+
+private:
+
+    String _url;
+    AwsEventHandler _handler;
+    std::vector<std::unique_ptr<AsyncWebSocketClient>> _clients;
+    uint32_t _nextId;
+    std::thread::id _tcpThread;
+    std::atomic<uint32_t> _foreign;
+
+    void checkThread() {
+        if (_tcpThread != std::thread::id() && std::this_thread::get_id() != _tcpThread) _foreign++;
+    }
+
+    void event(AsyncWebSocketClient* c, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+        _tcpThread = std::this_thread::get_id();
+        if (_handler) _handler(this, c, type, arg, data, len);
+    }
+
+public:
+
+    explicit AsyncWebSocket(const String& url) : _url(url), _nextId(1), _foreign(0) {}
+
+    const char* url() const { return _url.c_str(); }
+    void onEvent(AwsEventHandler handler) { _handler = handler; }
+
+    size_t count() const { return _clients.size(); }
+
+    AsyncWebSocketClient* client(uint32_t id) {
+        for (auto& c : _clients) if (c->id() == id) return c.get();
+        return nullptr;
+    }
+
+    bool availableForWriteAll() {
+        for (auto& c : _clients) if (!c->canSend()) return false;
+        return true;
+    }
+
+    void binaryAll(const uint8_t* data, size_t len) {
+        checkThread();
+        for (auto& c : _clients) c->binary(data, len);
+    }
+    void textAll(const char* s) {
+        checkThread();
+        for (auto& c : _clients) c->text(s);
+    }
+
+    void cleanupClients(uint16_t maxClients = 8) {
+        checkThread();
+        while (_clients.size() > maxClients) _clients.erase(_clients.begin());
+    }
+
+    // === Хост: події від імені AsyncTCP ===
+    AsyncWebSocketClient* fakeConnect() {
+        _clients.emplace_back(new AsyncWebSocketClient(_nextId++));
+        AsyncWebSocketClient* c = _clients.back().get();
+        event(c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+        return c;
+    }
+
+    void fakeDisconnect(uint32_t id) {
+        for (size_t i = 0; i < _clients.size(); i++) {
+            if (_clients[i]->id() != id) continue;
+            event(_clients[i].get(), WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+            _clients.erase(_clients.begin() + i);
+            return;
+        }
+    }
+
+    // Одне текстове повідомлення одним кадром
+    void fakeMessage(uint32_t id, const char* text) {
+        AsyncWebSocketClient* c = client(id);
+        if (!c) return;
+        AwsFrameInfo info = {};
+        info.message_opcode = WS_TEXT;
+        info.opcode = WS_TEXT;
+        info.final  = 1;
+        info.len    = strlen(text);
+        event(c, WS_EVT_DATA, &info, (uint8_t*)text, strlen(text));
+    }
+
+    uint32_t foreignCalls() const { return _foreign; }
+
+};
+
+
+class AsyncWebServer {
+
+private:
+
+    struct Route {
+        std::string              uri;
+        WebRequestMethod         method;
+        ArRequestHandlerFunction fn;
+    };
+
+    std::vector<Route>            routes;
+    std::vector<AsyncWebHandler*> handlers;
+    ArRequestHandlerFunction      notFound;
+    bool started;
+
+public:
+
+    explicit AsyncWebServer(uint16_t port) : started(false) { (void)port; }
+
+    void on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction fn) {
+        routes.push_back(Route{ uri, method, fn });
+    }
+
+    AsyncWebHandler& addHandler(AsyncWebHandler* h) { handlers.push_back(h); return *h; }
+    void onNotFound(ArRequestHandlerFunction fn) { notFound = fn; }
+    void begin() { started = true; }
+
+    // === Хост ===
+    bool isStarted() const { return started; }
+    size_t routeCount() const { return routes.size(); }
+
+    // Як AsyncCallbackWebHandler::canHandle: точний шлях або шлях + "/..."
+    bool handle(AsyncWebServerRequest& req) {
+        std::string url = req.url().c_str();
+        for (auto& r : routes) {
+            if (url == r.uri || (url.size() > r.uri.size() && url.compare(0, r.uri.size(), r.uri) == 0
+                                 && url[r.uri.size()] == '/')) {
+                r.fn(&req);
+                return true;
+            }
+        }
+        if (notFound) notFound(&req);
+        else          req.send(404);
+        return false;
+    }
+
+    template <typename T>
+    T* findHandler() {
+        for (auto* h : handlers) if (T* t = dynamic_cast<T*>(h)) return t;
+        return nullptr;
+    }
+
+};
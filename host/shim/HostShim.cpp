@@ -0,0 +1,482 @@
+// Реалізація заміни Arduino-ESP32 для хоста (див. Arduino.h)
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <soc/gpio_struct.h>
+#include <Preferences.h>
+#include <Wire.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+// =========================================================
+//  Час
+// =========================================================
+
+namespace {
+
+    uint64_t realMicros() {
+        using namespace std::chrono;
+        static const steady_clock::time_point start = steady_clock::now();
+        return duration_cast<microseconds>(steady_clock::now() - start).count();
+    }
+
+    std::atomic<bool>     manualClock(false);
+    std::atomic<uint64_t> manualMicros(0);
+
+}
+
+namespace HostClock {
+
+    void setManual(bool manual, uint64_t startMicros) {
+        manualMicros = startMicros;
+        manualClock  = manual;
+    }
+
+    bool isManual() { return manualClock; }
+
+    void advanceMicros(uint64_t us) { manualMicros += us; }
+
+    uint64_t nowMicros() { return manualClock ? manualMicros.load() : realMicros(); }
+
+}
+
+void delay(unsigned long ms) {
+    if (HostClock::isManual()) HostClock::advanceMicros((uint64_t)ms * 1000);
+    else std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    if (HostClock::isManual()) HostClock::advanceMicros(us);
+    else std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+
+// =========================================================
+//  Піни
+// =========================================================
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    HostGpio::apply(pin < 32 ? 0 : 1, level != LOW, 1u << (pin & 31));
+}
+
+int digitalRead(uint8_t pin) { return HostGpio::level(pin) ? HIGH : LOW; }
+
+
+// =========================================================
+//  GPIO
+// =========================================================
+
+gpio_dev_t GPIO;
+
+namespace {
+    bool gpioRecording = false;
+    std::vector<HostGpio::Write> gpioLog;
+}
+
+namespace HostGpio {
+
+    void setRecording(bool on) { gpioRecording = on; }
+    void clearLog()            { gpioLog.clear(); }
+    const std::vector<Write>& log() { return gpioLog; }
+
+    bool level(uint8_t pin) {
+        uint32_t bank = pin < 32 ? GPIO.out : GPIO.out1.val;
+        return (bank >> (pin & 31)) & 1u;
+    }
+
+    void reset() {
+        GPIO.out = 0;
+        GPIO.out1.val = 0;
+        gpioLog.clear();
+    }
+
+    void apply(uint8_t bank, bool set, uint32_t mask) {
+        volatile uint32_t& out = bank ? GPIO.out1.val : GPIO.out;
+        if (set) out = out | mask;
+        else     out = out & ~mask;
+        if (gpioRecording) gpioLog.push_back(Write{ (uint32_t)micros(), bank, set, mask });
+    }
+
+}
+
+
+// =========================================================
+//  Завдання
+// =========================================================
+
+namespace {
+
+    std::atomic<bool>   tasksEnabled(false);
+    std::atomic<bool>   shuttingDown(false);
+    std::atomic<size_t> tasksCreated(0);
+    std::atomic<size_t> tasksRunning(0);
+
+    // Після виходу з main() статичні об'єкти руйнуються — потоки
+    // завдань більше не повертаються з vTaskDelay()
+    void stopTasks() { shuttingDown = true; }
+
+}
+
+namespace HostTasks {
+
+    void setEnabled(bool enabled) {
+        static bool registered = false;
+        if (!registered) { atexit(stopTasks); registered = true; }
+        tasksEnabled = enabled;
+    }
+
+    size_t created() { return tasksCreated; }
+    size_t running() { return tasksRunning; }
+
+}
+
+void vTaskDelay(TickType_t ticks) {
+    do {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ticks ? ticks : 1));
+    } while (shuttingDown);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg,
+                                   UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    tasksCreated++;
+    if (handle) *handle = nullptr;
+    if (!tasksEnabled) return pdPASS;
+    tasksRunning++;
+    std::thread(fn, arg).detach();
+    return pdPASS;
+}
+
+
+// =========================================================
+//  String
+// =========================================================
+
+void String::assign(const char* s, size_t n) {
+    if (n == 0) {
+        len = 0;
+        if (buf) buf[0] = 0;
+        return;
+    }
+    reserve(n);
+    memmove(buf, s, n);
+    buf[n] = 0;
+    len = n;
+}
+
+// Через operator new, а не realloc: лічильник алокацій у тестах
+// (test_alloc.cpp) бачить і String, як купу на пристрої
+bool String::reserve(size_t size) {
+    if (buf && cap >= size) return true;
+    char* next = new char[size + 1];
+    if (buf) memcpy(next, buf, len + 1);
+    else     next[0] = 0;
+    delete[] buf;
+    buf = next;
+    cap = size;
+    return true;
+}
+
+String& String::operator=(String&& o) noexcept {
+    if (this != &o) {
+        delete[] buf;
+        buf = o.buf; len = o.len; cap = o.cap;
+        o.buf = nullptr; o.len = o.cap = 0;
+    }
+    return *this;
+}
+
+String& String::concat(const char* s, size_t n) {
+    if (!n) return *this;
+    reserve(len + n);
+    memcpy(buf + len, s, n);
+    len += n;
+    buf[len] = 0;
+    return *this;
+}
+
+static String formatted(const char* fmt, ...) {
+    char tmp[48];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(tmp, sizeof(tmp), fmt, args);
+    va_end(args);
+    return String(tmp);
+}
+
+String::String(int v)           : String() { *this = formatted("%d", v); }
+String::String(unsigned int v)  : String() { *this = formatted("%u", v); }
+String::String(long v)          : String() { *this = formatted("%ld", v); }
+String::String(unsigned long v) : String() { *this = formatted("%lu", v); }
+String::String(float v, unsigned char d)  : String() { *this = formatted("%.*f", d, (double)v); }
+String::String(double v, unsigned char d) : String() { *this = formatted("%.*f", d, v); }
+
+
+// =========================================================
+//  Print / Serial
+// =========================================================
+
+size_t Print::printf(const char* fmt, ...) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(stackBuf, sizeof(stackBuf), fmt, args);
+    va_end(args);
+    if (n < 0) return 0;
+    if ((size_t)n < sizeof(stackBuf)) return write((const uint8_t*)stackBuf, n);
+
+    std::vector<char> big(n + 1);
+    va_start(args, fmt);
+    vsnprintf(big.data(), big.size(), fmt, args);
+    va_end(args);
+    return write((const uint8_t*)big.data(), n);
+}
+
+HardwareSerial Serial;
+
+// Скільки байтів TX-буфера вже пішло в лінію з моменту txStamp
+void HardwareSerial::drainTx() {
+    uint64_t now = HostClock::nowMicros();
+    if (baud) {
+        double drained = (now - txStamp) * (baud / 10.0) / 1e6;
+        txBytes = txBytes > drained ? txBytes - drained : 0;
+    } else {
+        txBytes = 0;
+    }
+    txStamp = now;
+}
+
+int HardwareSerial::availableForWrite() {
+    std::lock_guard<std::mutex> g(lock);
+    drainTx();
+    return (int)(TX_BUFFER - (size_t)txBytes);
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        {
+            std::lock_guard<std::mutex> g(lock);
+            drainTx();
+            size_t room = TX_BUFFER - (size_t)txBytes;
+            size_t n = min(room, len - done);
+            sent.append((const char*)data + done, n);
+            txBytes += n;
+            done += n;
+            if (done == len) break;
+        }
+        // TX-буфер повний: як на ESP32, write() чекає
+        if (HostClock::isManual()) HostClock::advanceMicros(100);
+        else std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return len;
+}
+
+
+// =========================================================
+//  ESP
+// =========================================================
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    uint64_t ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    return (uint32_t)(ns * 240 / 1000);
+}
+
+
+// =========================================================
+//  WiFi
+// =========================================================
+
+WiFiClass WiFi;
+
+bool WiFiClass::mode(wifi_mode_t m) {
+    bool staWas = mode_ == WIFI_STA || mode_ == WIFI_AP_STA;
+    bool apWas  = mode_ == WIFI_AP  || mode_ == WIFI_AP_STA;
+    mode_ = m;
+    bool sta = m == WIFI_STA || m == WIFI_AP_STA;
+    bool ap  = m == WIFI_AP  || m == WIFI_AP_STA;
+    if (staWas && !sta && staLinked) fakeStaDisconnected(8);     // ASSOC_LEAVE
+    if (apWas && !ap) { apRunning = false; stations.clear(); }
+    return true;
+}
+
+bool WiFiClass::softAP(const char*, const char*, int, int, int) {
+    if (mode_ != WIFI_AP && mode_ != WIFI_AP_STA) return false;
+    apRunning = true;
+    emit(ARDUINO_EVENT_WIFI_AP_START);
+    return true;
+}
+
+wl_status_t WiFiClass::begin(const char*, const char*) {
+    beginCalls++;
+    return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool, bool) {
+    disconnects++;
+    if (staLinked) fakeStaDisconnected(8);
+    return true;
+}
+
+void WiFiClass::emit(arduino_event_id_t event, arduino_event_info_t info) {
+    for (auto& h : handlers) h(event, info);
+}
+
+void WiFiClass::fakeStaConnected() {
+    staLinked = true;
+    emit(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+    emit(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+}
+
+void WiFiClass::fakeStaDisconnected(uint8_t reason) {
+    staLinked = false;
+    arduino_event_info_t info = {};
+    info.wifi_sta_disconnected.reason = reason;
+    emit(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, info);
+}
+
+void WiFiClass::fakeStationJoin(int8_t rssi) {
+    stations.push_back(rssi);
+    arduino_event_info_t info = {};
+    info.wifi_ap_staconnected.aid = (uint8_t)stations.size();
+    emit(ARDUINO_EVENT_WIFI_AP_STACONNECTED, info);
+}
+
+void WiFiClass::fakeStationLeave() {
+    if (stations.empty()) return;
+    arduino_event_info_t info = {};
+    info.wifi_ap_stadisconnected.aid = (uint8_t)stations.size();
+    stations.pop_back();
+    emit(ARDUINO_EVENT_WIFI_AP_STADISCONNECTED, info);
+}
+
+void WiFiClass::reset() {
+    handlers.clear();
+    mode_ = WIFI_OFF;
+    apRunning = staLinked = false;
+    beginCalls = disconnects = 0;
+    stations.clear();
+}
+
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t* list) {
+    if (!WiFi.apRunning) return ESP_FAIL;
+    list->num = 0;
+    for (int8_t rssi : WiFi.stations) {
+        if (list->num >= ESP_WIFI_MAX_CONN_NUM) break;
+        list->sta[list->num].rssi = rssi;
+        list->num++;
+    }
+    return ESP_OK;
+}
+
+
+// =========================================================
+//  I2C
+// =========================================================
+
+TwoWire Wire;
+
+
+// =========================================================
+//  Preferences
+// =========================================================
+
+namespace {
+    std::string prefsDirectory = ".";
+    uint32_t    prefsWrites    = 0;
+}
+
+namespace HostPreferences {
+
+    void setDirectory(const char* dir) { prefsDirectory = dir; }
+
+    std::string pathFor(const char* name) { return prefsDirectory + "/" + name + ".nvs"; }
+
+    uint32_t writes() { return prefsWrites; }
+
+}
+
+void Preferences::load() {
+    values.clear();
+    FILE* f = fopen(HostPreferences::pathFor(name.c_str()).c_str(), "rb");
+    if (!f) return;
+    for (;;) {
+        uint8_t  keyLen;
+        uint32_t len;
+        if (fread(&keyLen, 1, 1, f) != 1) break;
+        std::string key(keyLen, '\0');
+        if (fread(&key[0], 1, keyLen, f) != keyLen) break;
+        if (fread(&len, sizeof(len), 1, f) != 1) break;
+        std::vector<uint8_t> bytes(len);
+        if (len && fread(bytes.data(), 1, len, f) != len) break;
+        values[key] = bytes;
+    }
+    fclose(f);
+}
+
+bool Preferences::flush() {
+    prefsWrites++;
+    FILE* f = fopen(HostPreferences::pathFor(name.c_str()).c_str(), "wb");
+    if (!f) return false;
+    bool ok = true;
+    for (const auto& kv : values) {
+        uint8_t  keyLen = (uint8_t)kv.first.size();
+        uint32_t len    = (uint32_t)kv.second.size();
+        ok = ok && fwrite(&keyLen, 1, 1, f) == 1
+                && fwrite(kv.first.data(), 1, keyLen, f) == keyLen
+                && fwrite(&len, sizeof(len), 1, f) == 1
+                && (len == 0 || fwrite(kv.second.data(), 1, len, f) == len);
+    }
+    return fclose(f) == 0 && ok;
+}
+
+bool Preferences::begin(const char* ns, bool ro, const char*) {
+    name     = ns;
+    readOnly = ro;
+    started  = true;
+    load();
+    return true;
+}
+
+void Preferences::end() { started = false; values.clear(); }
+
+bool Preferences::clear() {
+    if (!started || readOnly) return false;
+    values.clear();
+    return flush();
+}
+
+bool Preferences::remove(const char* key) {
+    if (!started || readOnly || !values.erase(key)) return false;
+    return flush();
+}
+
+bool Preferences::isKey(const char* key) { return started && values.count(key) != 0; }
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!started || readOnly || strlen(key) > 15) return 0;     // NVS: ключ до 15 символів
+    const uint8_t* p = static_cast<const uint8_t*>(value);
+    values[key].assign(p, p + len);
+    return flush() ? len : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    auto it = values.find(key);
+    if (!started || it == values.end() || it->second.size() > maxLen) return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    auto it = values.find(key);
+    return (started && it != values.end()) ? it->second.size() : 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// =========================================================
+//  MPU6050_tockn на хості: значення задає тест або симулятор
+//  Кути і гіроскоп (°, °/с) — уже після зміщень, як у бібліотеці;
+//  сирі одиниці — для калібрування (±500 °/с: 65.5 на °/с)
+//  onUpdate викликається з update() — симулятор рахує там фізику
+// =========================================================
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <functional>
+
+class MPU6050 {
+
+public:
+
+    // === Стан фейкового датчика ===
+    float   angleX = 0, angleY = 0, angleZ = 0;
+    float   gyroX  = 0, gyroY  = 0, gyroZ  = 0;
+    int16_t rawAccX = 0, rawAccY = 0, rawAccZ = 16384;
+    int16_t rawGyroX = 0, rawGyroY = 0, rawGyroZ = 0;
+    float   offsetX = 0, offsetY = 0, offsetZ = 0;
+    uint32_t updates = 0;
+    std::function<void(MPU6050&)> onUpdate;
+
+    explicit MPU6050(TwoWire&) {}
+
+    void begin() {}
+    void calcGyroOffsets(bool = false) {}
+    void setGyroOffsets(float x, float y, float z) { offsetX = x; offsetY = y; offsetZ = z; }
+
+    void update() {
+        updates++;
+        if (onUpdate) onUpdate(*this);
+    }
+
+    float getAngleX() const { return angleX; }
+    float getAngleY() const { return angleY; }
+    float getAngleZ() const { return angleZ; }
+    float getGyroX()  const { return gyroX; }
+    float getGyroY()  const { return gyroY; }
+    float getGyroZ()  const { return gyroZ; }
+
+    int16_t getRawAccX()  const { return rawAccX; }
+    int16_t getRawAccY()  const { return rawAccY; }
+    int16_t getRawAccZ()  const { return rawAccZ; }
+    int16_t getRawGyroX() const { return rawGyroX; }
+    int16_t getRawGyroY() const { return rawGyroY; }
+    int16_t getRawGyroZ() const { return rawGyroZ; }
+
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+// =========================================================
+//  Preferences (NVS) на хості: простір імен — файл <dir>/<name>.nvs
+//  Кожен put переписує файл, begin() читає його заново — новий
+//  об'єкт бачить те, що зберіг попередній, як після перезавантаження
+//  Запис: keyLen u8 | key | len u32 | bytes
+// =========================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace HostPreferences {
+    void        setDirectory(const char* dir);     // за замовчуванням "."
+    std::string pathFor(const char* name);
+    uint32_t    writes();                          // put/remove/clear з початку процесу
+}
+
+class Preferences {
+
+private:
+
+    std::string name;
+    bool        readOnly = false;
+    bool        started  = false;
+    std::map<std::string, std::vector<uint8_t>> values;
+
+    void load();
+    bool flush();
+
+public:
+
+    bool   begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void   end();
+
+    bool   clear();
+    bool   remove(const char* key);
+    bool   isKey(const char* key);
+
+    size_t putBytes(const char* key, const void* value, size_t len);
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+    size_t getBytesLength(const char* key);
+
+};
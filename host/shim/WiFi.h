@@ -0,0 +1,102 @@
+#pragma once
+
+// =========================================================
+//  WiFi на хості: режими, події Arduino-ESP32, AP і STA без радіо
+//  Події доставляються синхронно з виклику, який їх спричинив
+// =========================================================
+
+#include <Arduino.h>
+#include <vector>
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA,
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+} wl_status_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_AP_START,
+    ARDUINO_EVENT_WIFI_AP_STOP,
+    ARDUINO_EVENT_WIFI_AP_STACONNECTED,
+    ARDUINO_EVENT_WIFI_AP_STADISCONNECTED,
+    ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef struct { uint8_t ssid[32]; uint8_t ssid_len; uint8_t bssid[6]; uint8_t reason; } wifi_event_sta_disconnected_t;
+typedef struct { uint8_t mac[6]; uint8_t aid; } wifi_event_ap_staconnected_t;
+typedef struct { uint8_t mac[6]; uint8_t aid; } wifi_event_ap_stadisconnected_t;
+
+typedef union {
+    wifi_event_sta_disconnected_t   wifi_sta_disconnected;
+    wifi_event_ap_staconnected_t    wifi_ap_staconnected;
+    wifi_event_ap_stadisconnected_t wifi_ap_stadisconnected;
+} arduino_event_info_t;
+
+typedef std::function<void(arduino_event_id_t, arduino_event_info_t)> WiFiEventFuncCb;
+
+
+class WiFiClass {
+
+private:
+
+    std::vector<WiFiEventFuncCb> handlers;
+
+public:
+
+    // === Стан фейкового радіо (тести читають і змінюють напряму) ===
+    wifi_mode_t mode_       = WIFI_OFF;
+    bool        apRunning   = false;
+    bool        staLinked   = false;
+    int8_t      staRssi     = -60;
+    uint32_t    beginCalls  = 0;
+    uint32_t    disconnects = 0;
+    std::vector<int8_t> stations;          // RSSI клієнтів AP
+
+    // === API Arduino-ESP32 ===
+    void persistent(bool) {}
+    void setAutoReconnect(bool) {}
+    void onEvent(WiFiEventFuncCb cb) { handlers.push_back(cb); }
+
+    bool        mode(wifi_mode_t m);
+    wifi_mode_t getMode() const { return mode_; }
+
+    bool      softAP(const char* ssid, const char* pass = nullptr, int channel = 1, int hidden = 0, int maxConn = 4);
+    IPAddress softAPIP() const { return apRunning ? IPAddress(192, 168, 4, 1) : IPAddress(); }
+
+    wl_status_t begin(const char* ssid, const char* pass = nullptr);
+    bool        disconnect(bool wifiOff = false, bool eraseAp = false);
+    wl_status_t status() const { return staLinked ? WL_CONNECTED : WL_DISCONNECTED; }
+    IPAddress   localIP() const { return staLinked ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+    int8_t      RSSI() const { return staLinked ? staRssi : 0; }
+
+    // === Хост: події, ніби від мережевого стеку ===
+    void emit(arduino_event_id_t event, arduino_event_info_t info = arduino_event_info_t());
+    void fakeStaConnected();                 // STA_CONNECTED + GOT_IP
+    void fakeStaDisconnected(uint8_t reason);
+    void fakeStationJoin(int8_t rssi);
+    void fakeStationLeave();
+    void reset();
+
+};
+
+extern WiFiClass WiFi;
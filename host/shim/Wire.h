@@ -0,0 +1,13 @@
+#pragma once
+
+// I2C на хості: лише те, що викликають setup() і MPU6050_tockn
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { (void)sda; (void)scl; (void)frequency; return true; }
+    void setClock(uint32_t) {}
+};
+
+extern TwoWire Wire;
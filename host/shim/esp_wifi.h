@@ -0,0 +1,24 @@
+#pragma once
+
+// esp_wifi: список клієнтів AP з фейкового WiFi (WiFi.stations)
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+#define ESP_WIFI_MAX_CONN_NUM 10
+
+typedef struct {
+    uint8_t mac[6];
+    int8_t  rssi;
+} wifi_sta_info_t;
+
+typedef struct {
+    wifi_sta_info_t sta[ESP_WIFI_MAX_CONN_NUM];
+    int             num;
+} wifi_sta_list_t;
+
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t* list);
@@ -0,0 +1,54 @@
+#pragma once
+
+// =========================================================
+//  Регістри виводу GPIO ESP32 на хості
+//  Запис у *_w1ts / *_w1tc змінює out / out1, як на залізі, і
+//  (якщо HostGpio::setRecording(true)) потрапляє в журнал з часом
+//  micros() — тести відновлюють з нього фронти кожного піна
+// =========================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace HostGpio {
+
+    // Один запис у регістр set/clear
+    struct Write {
+        uint32_t timeMicros;
+        uint8_t  bank;       // 0 — піни 0..31, 1 — 32..39
+        bool     set;        // w1ts; false — w1tc
+        uint32_t mask;
+    };
+
+    void  setRecording(bool on);
+    void  clearLog();
+    const std::vector<Write>& log();
+
+    // Рівень піна після всіх записів
+    bool  level(uint8_t pin);
+    void  reset();
+
+    void  apply(uint8_t bank, bool set, uint32_t mask);
+
+}
+
+// Регістр лише для запису: присвоєння = одна операція set або clear
+template <uint8_t BANK, bool SET>
+struct HostGpioW1Reg {
+    HostGpioW1Reg& operator=(uint32_t mask) {
+        HostGpio::apply(BANK, SET, mask);
+        return *this;
+    }
+};
+
+typedef struct {
+    HostGpioW1Reg<0, true>  out_w1ts;
+    HostGpioW1Reg<0, false> out_w1tc;
+    struct { HostGpioW1Reg<1, true>  val; } out1_w1ts;
+    struct { HostGpioW1Reg<1, false> val; } out1_w1tc;
+    volatile uint32_t out;
+    struct { volatile uint32_t val; } out1;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
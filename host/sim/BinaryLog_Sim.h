@@ -0,0 +1,36 @@
+#pragma once
+
+// =========================================================
+//  Розбір тіла відповіді .bblog (/blackbox) у тестах:
+//  заголовок + усі записи, які декодер прийняв
+//
+//  Тести: test_blackbox, test_robot_fall
+// =========================================================
+
+#include <string>
+#include <vector>
+
+#include "BinaryLog_Format.h"
+
+namespace BinaryLogSim {
+
+    // Порожній результат — не BBLG або непідтримувана версія
+    inline std::vector<BinaryLog_Sample> decodeBody(const std::string& body) {
+        std::vector<BinaryLog_Sample> out;
+        const uint8_t* data = (const uint8_t*)body.data();
+        BinaryLog_Decoder dec;
+        if (!dec.readHeader(data, body.size())) return out;
+
+        size_t off = BinaryLog::HEADER_SIZE;
+        while (off < body.size()) {
+            BinaryLog_Sample s;
+            bool ok;
+            size_t used = dec.decode(data + off, body.size() - off, s, ok);
+            if (ok) out.push_back(s);
+            if (used == 0) break;
+            off += used;
+        }
+        return out;
+    }
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+// =========================================================
+//  RobotController цілком на хості — ті самі об'єкти, що в main.cpp,
+//  на фейкових MPU, WiFi і веб-сервері
+//
+//  Час — ручний: loop() кожні loopMicros мкс. MPU6050::onUpdate
+//  викликається з такту (mpu6050.update()) — там тест задає кут
+//  або блокує такт (advanceMicros), як повільне читання I2C
+//
+//  Тести: test_network, test_link_loss, test_step_stall, test_robot_fall
+// =========================================================
+
+#include <functional>
+
+#include "ControlPage_WebPageGz.h"
+#include "RobotConrtroller_Controller.h"
+
+namespace RobotSim {
+
+    typedef StepperMotor_Controller<33, 14, 26> LeftMotor;
+    typedef StepperMotor_Controller<32, 25, 27> RightMotor;
+
+    struct Rig {
+        AsyncWebServer             server{80};
+        MPU6050                    mpu{Wire};
+        LeftMotor                  left;
+        RightMotor                 right;
+        BalanceController          balance;
+        SteeringController         steering;
+        NetworkConnection_Manager  network{"router", "pass", "BalanceBot", "12345678"};
+        ControlPage_Router         router{&server};
+        Telemetry_Stream           telemetry{&server};
+        BinaryLog_Sink             binLog{&server, Serial};
+        BlackBox_Recorder          blackBox{&server};
+        LoopMetrics_Manager        metrics{&server};
+        RobotConfig_Store          config{&server};
+        const ControlPage_Asset    page{ controlPageGz, sizeof(controlPageGz), controlPageETag };
+
+        RobotController<LeftMotor, RightMotor> robot{
+            mpu, left, right, balance, steering, router, network,
+            telemetry, binLog, blackBox, metrics, config, page };
+
+        uint32_t loopMicros = 100;
+
+        // Ручний час з startMs від скидання (setup() до robot.begin())
+        explicit Rig(uint32_t startMs = 300) {
+            HostClock::setManual(true, (uint64_t)startMs * 1000);
+            WiFi.reset();
+        }
+
+        ~Rig() {
+            WiFi.reset();                 // обробники подій тримають network
+            HostClock::setManual(false);
+        }
+
+        Rig(const Rig&) = delete;
+        Rig& operator=(const Rig&) = delete;
+
+        void begin() { robot.begin(); }
+
+        // loop() протягом ms; until — зупинитись раніше
+        void run(uint32_t ms, const std::function<bool()>& until = nullptr) {
+            uint64_t end = HostClock::nowMicros() + (uint64_t)ms * 1000;
+            while (HostClock::nowMicros() < end) {
+                if (until && until()) return;
+                robot.run();
+                HostClock::advanceMicros(loopMicros);
+            }
+        }
+
+        // Запит до веб-сервера, як від сторінки керування
+        int get(const char* target) {
+            AsyncWebServerRequest req(target);
+            server.handle(req);
+            return req.code();
+        }
+    };
+
+}
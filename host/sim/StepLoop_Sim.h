@@ -0,0 +1,206 @@
+#pragma once
+
+// =========================================================
+//  Симуляція loop() з генерацією кроків на хості
+//
+//  runSteppers() кожні loopMicros мкс ручного часу; заплановані
+//  затримки (stall) — як блокуючий виклик у loop(): Serial, запис
+//  у flash, повільний mpu.update(). Кожен фронт STEP береться з
+//  журналу HostGpio, а не з лічильників мотора, тож ту саму
+//  симуляцію можна прогнати для іншого бекенда кроків (RMT,
+//  таймер) і порівняти з ідеальною послідовністю
+//
+//  Те саме для цілого RobotController (run(robot, ...)): затримки
+//  тоді потрапляють усередину такту керування — у mpu6050.update(),
+//  як повільне читання I2C, — а ідеальна послідовність будується
+//  з швидкостей, які такт задав моторам
+//
+//  Тести: host/test/test_step_stall.cpp, бенчмарк: bench_step_sim.cpp
+// =========================================================
+
+#include <cmath>
+#include <vector>
+
+#include "SteperMotor_Controller.h"
+
+namespace StepSim {
+
+    struct Stall {
+        uint32_t atMicros;        // від початку симуляції
+        uint32_t durationMicros;
+    };
+
+    // Порівняння фактичних фронтів з ідеальною послідовністю
+    struct TrainDiff {
+        uint32_t produced;        // фактичних кроків
+        uint32_t ideal;           // стільки видала б ідеальна послідовність
+        uint32_t maxLateMicros;   // найбільше відставання фронту від ідеального
+        int32_t  positionError;   // produced - ideal
+    };
+
+    // Фронти HIGH піна pin за журналом записів у регістри
+    inline std::vector<uint32_t> risesOf(uint8_t pin) {
+        std::vector<uint32_t> out;
+        uint8_t  bank  = pin < 32 ? 0 : 1;
+        uint32_t mask  = 1u << (pin & 31);
+        bool     level = false;
+        for (const HostGpio::Write& w : HostGpio::log()) {
+            if (w.bank != bank || !(w.mask & mask)) continue;
+            if (w.set && !level) out.push_back(w.timeMicros);
+            level = w.set;
+        }
+        return out;
+    }
+
+    // Швидкість, задана мотору з atMicros (кр/с, без знака)
+    struct SpeedChange {
+        uint32_t atMicros;
+        float    stepsPerSec;
+    };
+
+    // Ідеальна послідовність: k-й крок о startMicros + k·interval, k ≥ 1
+    inline TrainDiff compareIdeal(const std::vector<uint32_t>& rises, uint32_t startMicros,
+                                  uint32_t endMicros, uint32_t intervalMicros) {
+        TrainDiff d = {};
+        d.produced = rises.size();
+        d.ideal    = (endMicros - startMicros) / intervalMicros;
+        for (size_t k = 0; k < rises.size(); k++) {
+            uint32_t expected = startMicros + (k + 1) * intervalMicros;
+            if (rises[k] > expected && rises[k] - expected > d.maxLateMicros) {
+                d.maxLateMicros = rises[k] - expected;
+            }
+        }
+        d.positionError = (int32_t)d.produced - (int32_t)d.ideal;
+        return d;
+    }
+
+    // Ідеальна послідовність для змінної швидкості: k-й крок — там, де
+    // інтеграл заданої швидкості від startMicros досягає k
+    inline TrainDiff compareCommanded(const std::vector<uint32_t>& rises, const std::vector<SpeedChange>& speeds,
+                                      uint32_t startMicros, uint32_t endMicros) {
+        std::vector<uint32_t> ideal;
+        double phase = 0;
+        for (size_t i = 0; i < speeds.size(); i++) {
+            uint32_t from = speeds[i].atMicros > startMicros ? speeds[i].atMicros : startMicros;
+            uint32_t to   = i + 1 < speeds.size() ? speeds[i + 1].atMicros : endMicros;
+            if (to <= from || speeds[i].stepsPerSec <= 0) continue;
+            double perMicro = speeds[i].stepsPerSec / 1e6;
+            double next = phase + (to - from) * perMicro;
+            for (double k = floor(phase) + 1; k <= next; k++) {
+                ideal.push_back(from + (uint32_t)((k - phase) / perMicro));
+            }
+            phase = next;
+        }
+
+        TrainDiff d = {};
+        d.produced = rises.size();
+        d.ideal    = ideal.size();
+        for (size_t k = 0; k < rises.size() && k < ideal.size(); k++) {
+            if (rises[k] > ideal[k] && rises[k] - ideal[k] > d.maxLateMicros) {
+                d.maxLateMicros = rises[k] - ideal[k];
+            }
+        }
+        d.positionError = (int32_t)d.produced - (int32_t)d.ideal;
+        return d;
+    }
+
+    // Ручний час і запис GPIO на весь час життя об'єкта
+    class Loop {
+
+    private:
+
+        uint32_t loopMicros;
+        std::vector<Stall> stalls;
+        uint32_t startMicros;
+        uint32_t endMicros;
+        std::vector<SpeedChange> speeds[2];     // run(robot): лівий, правий
+
+        template <typename Motor>
+        void trackSpeed(std::vector<SpeedChange>& log, const Motor& m) {
+            float v = m.isEnabled() ? m.getSpeed() : 0.0f;
+            if (log.empty() || log.back().stepsPerSec != v) log.push_back(SpeedChange{ (uint32_t)micros(), v });
+        }
+
+    public:
+
+        explicit Loop(uint32_t loopMicros = 5) : loopMicros(loopMicros), startMicros(0), endMicros(0) {
+            HostClock::setManual(true, 0);
+            HostGpio::reset();
+            HostGpio::setRecording(true);
+        }
+
+        ~Loop() {
+            HostGpio::setRecording(false);
+            HostClock::setManual(false);
+        }
+
+        Loop(const Loop&) = delete;
+        Loop& operator=(const Loop&) = delete;
+
+        // Затримки — у порядку зростання atMicros
+        void addStall(uint32_t atMicros, uint32_t durationMicros) {
+            stalls.push_back(Stall{ atMicros, durationMicros });
+        }
+
+        template <typename MotorA, typename MotorB>
+        void run(MotorA& a, MotorB& b, uint32_t durationMicros) {
+            HostGpio::clearLog();
+            startMicros = micros();
+            size_t next = 0;
+            while (micros() - startMicros < durationMicros) {
+                runSteppers(a, b);
+                HostClock::advanceMicros(loopMicros);
+                while (next < stalls.size() && micros() - startMicros >= stalls[next].atMicros) {
+                    HostClock::advanceMicros(stalls[next++].durationMicros);
+                }
+            }
+            endMicros = micros();
+        }
+
+        // Цілий такт керування: robot.run() кожні loopMicros. Затримка, час
+        // якої настав, виконується в наступному mpu6050.update()
+        template <typename Robot>
+        void run(Robot& robot, uint32_t durationMicros) {
+            HostGpio::clearLog();
+            startMicros = micros();
+            speeds[0].clear();
+            speeds[1].clear();
+            size_t next = 0;
+
+            auto sensor = robot.mpu6050.onUpdate;
+            robot.mpu6050.onUpdate = [&](auto& mpu) {
+                while (next < stalls.size() && micros() - startMicros >= stalls[next].atMicros) {
+                    HostClock::advanceMicros(stalls[next++].durationMicros);
+                }
+                if (sensor) sensor(mpu);
+            };
+
+            trackSpeed(speeds[0], robot.leftMotor);
+            trackSpeed(speeds[1], robot.rightMotor);
+            while (micros() - startMicros < durationMicros) {
+                robot.run();
+                trackSpeed(speeds[0], robot.leftMotor);
+                trackSpeed(speeds[1], robot.rightMotor);
+                HostClock::advanceMicros(loopMicros);
+            }
+            endMicros = micros();
+            robot.mpu6050.onUpdate = sensor;
+        }
+
+        TrainDiff compare(uint8_t stepPin, uint32_t intervalMicros) const {
+            return compareIdeal(risesOf(stepPin), startMicros, endMicros, intervalMicros);
+        }
+
+        // Після run(robot): фронти мотора (0 — лівий, 1 — правий) проти заданих тактом швидкостей
+        TrainDiff compareCommanded(uint8_t stepPin, int motor) const {
+            return StepSim::compareCommanded(risesOf(stepPin), speeds[motor], startMicros, endMicros);
+        }
+
+        const std::vector<SpeedChange>& getSpeeds(int motor) const { return speeds[motor]; }
+
+        uint32_t getStartMicros() const { return startMicros; }
+        uint32_t getEndMicros()   const { return endMicros; }
+
+    };
+
+}
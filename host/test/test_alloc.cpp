@@ -0,0 +1,96 @@
+// Алокації на запит: operator new/delete цього виконуваного файла рахують
+// усе, включно з String заміни. Запит і сховище відповіді будуються до
+// підрахунку — лічильник бачить лише сам обробник
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <new>
+
+#include "ControlPage_Routes.h"
+#include "RobotConfig_Store.h"
+
+namespace {
+
+std::atomic<bool>     counting(false);
+std::atomic<uint32_t> allocations(0);
+
+}
+
+void* operator new(size_t size) {
+    if (counting) allocations++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void  operator delete(void* p) noexcept { free(p); }
+void  operator delete[](void* p) noexcept { free(p); }
+void  operator delete(void* p, size_t) noexcept { free(p); }
+void  operator delete[](void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+struct Alloc : ::testing::Test {
+    AsyncWebServer     server{80};
+    ControlPage_Router router{&server};
+    RobotConfig_Store  config{&server};
+
+    void SetUp() override {
+        static const uint8_t page[] = { 0x1f, 0x8b, 0 };
+        router.setupRoutes(ControlPage_Asset{ page, sizeof(page), "\"abc\"" });
+        config.begin();
+        // Статичні типи вмісту і перший клієнт статистики зв'язку — до підрахунку
+        for (const char* t : { "/move?v=0&h=0&s=150&sid=1&n=1", "/ping", "/heap", "/link", "/echo?t=1" }) {
+            AsyncWebServerRequest warm(t);
+            server.handle(warm);
+        }
+    }
+
+    uint32_t count(const char* target, int code = 200) {
+        AsyncWebServerRequest req(target);
+        allocations = 0;
+        counting = true;
+        server.handle(req);
+        counting = false;
+        EXPECT_EQ(req.code(), code) << target;
+        return allocations;
+    }
+};
+
+}
+
+
+TEST_F(Alloc, CommandRoutesAllocateNothing) {
+    EXPECT_EQ(count("/move?v=1&h=-1&s=200&sid=1&n=2"), 0u);
+    EXPECT_EQ(count("/direction?val=forward"), 0u);
+    EXPECT_EQ(router.getCommand().direction, FORWARD);       // розібрано, а не відкинуто
+    EXPECT_EQ(count("/speed?val=180"), 0u);
+    EXPECT_EQ(count("/steer?val=70"), 0u);
+    EXPECT_EQ(count("/link"), 0u);
+}
+
+// Тіло зі стекового буфера: одна копія у відповідь (sendBuffer)
+TEST_F(Alloc, BufferRoutesCopyBodyOnce) {
+    EXPECT_EQ(count("/ping"), 1u);
+    EXPECT_EQ(count("/heap"), 1u);
+    EXPECT_EQ(count("/echo?t=5&r=12"), 1u);
+}
+
+// Відмови /config: сталий текст з flash або ім'я параметра — без String типу вмісту
+TEST_F(Alloc, ConfigErrorsBuildNoTypeString) {
+    config.setSaveAllowed(false);
+    EXPECT_EQ(count("/config/save", 409), 0u);
+    EXPECT_EQ(count("/config/set?innerKp=abc", 400), 1u);
+    EXPECT_EQ(count("/config/set?bogus=1", 400), 1u);
+}
+
+// Лічильник бачить те, від чого рятує WebRequest::findParam
+TEST_F(Alloc, CounterSeesStringTemporaries) {
+    AsyncWebServerRequest req("/speed?val=180");
+    allocations = 0;
+    counting = true;
+    bool has = req.hasParam("val");
+    counting = false;
+    EXPECT_TRUE(has);
+    EXPECT_GE(allocations.load(), 1u);
+}
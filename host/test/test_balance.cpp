@@ -0,0 +1,76 @@
+// BalanceController: знак реакції, межі виходу, вимкнений стан, зміна Ki на ходу
+
+#include <gtest/gtest.h>
+
+#include "BalancePID_Manager.h"
+
+namespace {
+
+BalanceController make() {
+    BalanceController b;
+    b.setInnerPID(600, 5000, 15);
+    b.setOuterPID(3);
+    b.begin(0);
+    b.setEnabled(true);
+    return b;
+}
+
+}
+
+
+TEST(Balance, PositivePitchGivesNegativeBaseSpeed) {
+    BalanceController b = make();
+    // pitch > 0 — помилка targetAngle - pitch від'ємна (знак, як у LOGS)
+    b.update(2.0f, 10);
+    EXPECT_LT(b.getBaseSpeed(), 0.0f);
+    EXPECT_LT(b.getTermP(), 0.0f);
+}
+
+TEST(Balance, OutputClamped) {
+    BalanceController b = make();
+    for (unsigned long t = 10; t < 2000; t += 10) b.update(30.0f, t);
+    EXPECT_FLOAT_EQ(b.getBaseSpeed(), -15000.0f);
+}
+
+TEST(Balance, DisabledOutputsZero) {
+    BalanceController b = make();
+    b.update(5.0f, 10);
+    b.setEnabled(false);
+    b.update(5.0f, 20);
+    EXPECT_EQ(b.getBaseSpeed(), 0.0f);
+    EXPECT_EQ(b.getEstimatedSpeed(), 0.0f);
+}
+
+TEST(Balance, Deterministic) {
+    BalanceController a = make();
+    BalanceController b = make();
+    for (unsigned long t = 10; t < 1000; t += 10) {
+        float pitch = 3.0f * sinf(t * 0.01f);
+        a.update(pitch, t);
+        b.update(pitch, t);
+    }
+    EXPECT_EQ(a.getBaseSpeed(), b.getBaseSpeed());
+}
+
+// I-складова зберігається як Σ Ki·e·dt: новий Ki (навіть 0) не змінює її
+TEST(Balance, GainChangeIsBumpless) {
+    BalanceController b = make();
+    for (unsigned long t = 10; t <= 200; t += 10) b.update(0.2f, t);
+    float before = b.getTermI();
+    ASSERT_LT(before, 0.0f);
+
+    b.setInnerGains(600, 0, 15);
+    b.update(0.2f, 210);
+    EXPECT_FLOAT_EQ(b.getTermI(), before);
+
+    b.setInnerGains(600, 100, 15);
+    b.update(0.2f, 220);
+    EXPECT_NEAR(b.getTermI(), before, 100 * 0.2f * 0.01f + 1e-3f);
+}
+
+TEST(Balance, IntegralClampedToMaxSpeed) {
+    BalanceController b = make();
+    b.setMaxSpeed(4000);
+    for (unsigned long t = 10; t < 5000; t += 10) b.update(5.0f, t);
+    EXPECT_FLOAT_EQ(b.getTermI(), -4000.0f);
+}
@@ -0,0 +1,144 @@
+// BinaryLog: кодер/декодер v2 (seq, len, crc8), відновлення після втрат, маршрут /log
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "BinaryLog_Sink.h"
+
+namespace {
+
+BinaryLog_Sample sampleAt(int i) {
+    BinaryLog_Sample s;
+    s.clear();
+    s.v[BLOG_TIME_MS] = i * 10;
+    s.set(BLOG_PITCH, 0.5f * (i % 7) - 1.0f);
+    s.v[BLOG_LEFT_POS] = i * 3;
+    s.v[BLOG_FLAGS] = (i % 5 == 0) ? TELEM_FALLEN : 0;
+    return s;
+}
+
+// Записи по одному — щоб тест міг вирізати будь-який
+std::vector<std::vector<uint8_t>> encodeRecords(int count) {
+    BinaryLog_Encoder enc;
+    std::vector<std::vector<uint8_t>> out;
+    uint8_t buf[BinaryLog::MAX_RECORD_SIZE];
+    for (int i = 0; i < count; i++) {
+        size_t n = enc.encode(sampleAt(i), buf);
+        out.emplace_back(buf, buf + n);
+    }
+    return out;
+}
+
+std::vector<uint8_t> header(uint8_t version = BinaryLog::VERSION) {
+    std::vector<uint8_t> h(BinaryLog::HEADER_SIZE);
+    BinaryLog::writeHeader(h.data());
+    h[4] = version;
+    return h;
+}
+
+std::vector<BinaryLog_Sample> decodeAll(const std::vector<uint8_t>& data, BinaryLog_Decoder& dec) {
+    std::vector<BinaryLog_Sample> out;
+    EXPECT_TRUE(dec.readHeader(data.data(), data.size()));
+    size_t off = BinaryLog::HEADER_SIZE;
+    while (off < data.size()) {
+        BinaryLog_Sample s;
+        bool got;
+        size_t used = dec.decode(&data[off], data.size() - off, s, got);
+        if (got) out.push_back(s);
+        if (used == 0) break;
+        off += used;
+    }
+    return out;
+}
+
+}
+
+
+TEST(BinaryLog, RoundTrip) {
+    std::vector<uint8_t> data = header();
+    for (auto& r : encodeRecords(200)) data.insert(data.end(), r.begin(), r.end());
+
+    BinaryLog_Decoder dec;
+    auto out = decodeAll(data, dec);
+    ASSERT_EQ(out.size(), 200u);
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(memcmp(out[i].v, sampleAt(i).v, sizeof(out[i].v)), 0) << i;
+    }
+    EXPECT_EQ(dec.skippedBytes, 0u);
+    EXPECT_EQ(dec.lostRecords, 0u);
+}
+
+TEST(BinaryLog, RecordLayout) {
+    auto recs = encodeRecords(2);
+    EXPECT_EQ(recs[0][0], BinaryLog::SYNC_KEY);
+    EXPECT_EQ(recs[1][0], BinaryLog::SYNC_DELTA);
+    EXPECT_EQ(recs[0][1], 0);
+    EXPECT_EQ(recs[1][1], 1);
+    EXPECT_EQ(recs[1][2] + BinaryLog::RECORD_OVERHEAD, recs[1].size());
+}
+
+// Втрачений запис: дельти після нього відкидаються до ключового
+TEST(BinaryLog, SeqGapDropsDeltasUntilKeyframe) {
+    auto recs = encodeRecords(200);
+    std::vector<uint8_t> data = header();
+    for (int i = 0; i < 200; i++) {
+        if (i == 10) continue;
+        data.insert(data.end(), recs[i].begin(), recs[i].end());
+    }
+
+    BinaryLog_Decoder dec;
+    auto out = decodeAll(data, dec);
+    EXPECT_EQ(dec.lostRecords, 1u);
+    // 0..9, потім з ключового 64 до кінця
+    ASSERT_EQ(out.size(), 10u + (200 - 64));
+    EXPECT_EQ(out[10].v[BLOG_TIME_MS], 640);
+    EXPECT_EQ(memcmp(out.back().v, sampleAt(199).v, sizeof(out.back().v)), 0);
+}
+
+// Пошкоджений байт: CRC відкидає запис, дельти чекають ключового
+TEST(BinaryLog, CorruptRecordRejected) {
+    auto recs = encodeRecords(100);
+    recs[20][4] ^= 0x01;
+    std::vector<uint8_t> data = header();
+    for (auto& r : recs) data.insert(data.end(), r.begin(), r.end());
+
+    BinaryLog_Decoder dec;
+    auto out = decodeAll(data, dec);
+    EXPECT_GE(dec.badRecords, 1u);
+    ASSERT_EQ(out.size(), 20u + (100 - 64));
+    for (const auto& s : out) {
+        int i = s.v[BLOG_TIME_MS] / 10;
+        EXPECT_EQ(memcmp(s.v, sampleAt(i).v, sizeof(s.v)), 0) << i;
+    }
+}
+
+TEST(BinaryLog, RejectsUnknownVersion) {
+    BinaryLog_Decoder dec;
+    auto h = header(BinaryLog::VERSION + 1);
+    EXPECT_FALSE(dec.readHeader(h.data(), h.size()));
+}
+
+// v1 (без seq/len/crc) більше не читається
+TEST(BinaryLog, RejectsVersion1) {
+    BinaryLog_Decoder dec;
+    auto h = header(1);
+    EXPECT_FALSE(dec.readHeader(h.data(), h.size()));
+    EXPECT_EQ(dec.getVersion(), 0);
+}
+
+TEST(BinaryLogSink, LogRouteToggles) {
+    AsyncWebServer server(80);
+    BinaryLog_Sink sink(&server, Serial);
+    sink.begin();
+
+    AsyncWebServerRequest on("/log?enable=1");
+    server.handle(on);
+    EXPECT_TRUE(sink.isEnabled());
+    EXPECT_EQ(on.response()->contentType, "application/json");
+    EXPECT_NE(on.body().find("\"enabled\":true"), std::string::npos) << on.body();
+
+    AsyncWebServerRequest off("/log?enable=0");
+    server.handle(off);
+    EXPECT_FALSE(sink.isEnabled());
+}
@@ -0,0 +1,111 @@
+// BlackBox_Recorder: маршрути freeze/arm/завантаження і вміст знімка
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "BinaryLog_Sim.h"
+#include "BlackBox_Recorder.h"
+
+namespace {
+
+struct BlackBox : ::testing::Test {
+    AsyncWebServer    server{80};
+    BlackBox_Recorder box{&server};
+
+    void SetUp() override { box.begin(); }
+
+    void record(int ticks) {
+        for (int i = 0; i < ticks; i++) {
+            BinaryLog_Tick* t = box.beginSample();
+            if (!t) return;
+            *t = BinaryLog_Tick();
+            t->timeMs = i * 10;
+            box.commit();
+        }
+    }
+
+    std::vector<BinaryLog_Sample> download() {
+        AsyncWebServerRequest dl("/blackbox");
+        server.handle(dl);
+        EXPECT_EQ(dl.code(), 200);
+        // Дрібні шматки: запис через межу
+        std::vector<BinaryLog_Sample> out = BinaryLogSim::decodeBody(dl.response()->body(512));
+        dl.disconnect();
+        return out;
+    }
+};
+
+}
+
+
+TEST_F(BlackBox, DownloadFreezesFirst) {
+    record(50);
+
+    AsyncWebServerRequest early("/blackbox");
+    server.handle(early);
+    EXPECT_EQ(early.code(), 409);
+    EXPECT_EQ(early.body(), "freezing, retry");
+
+    // Зупинку виконує наступний такт
+    EXPECT_EQ(box.beginSample(), nullptr);
+    EXPECT_TRUE(box.isFrozen());
+
+    std::vector<BinaryLog_Sample> got = download();
+    ASSERT_EQ(got.size(), 50u);
+    for (size_t i = 0; i < got.size(); i++) {
+        EXPECT_EQ(got[i].v[BLOG_TIME_MS], (int32_t)(i * 10));
+    }
+}
+
+// Слот — сирі float; фіксована точка з округленням — лише при завантаженні
+TEST_F(BlackBox, DownloadConvertsRawTicks) {
+    BinaryLog_Tick* t = box.beginSample();
+    ASSERT_NE(t, nullptr);
+    *t = BinaryLog_Tick();
+    t->timeMs    = 1234;
+    t->pitch     = -12.345f;
+    t->gyroZ     = 0.004f;
+    t->accZ      = 16384;
+    t->baseSpeed = 2499.6f;
+    t->leftSpeed = -800.5f;
+    t->leftPos   = 1 << 30;        // за межею точності float
+    t->cmdSteer  = 42;
+    t->flags     = TELEM_FALLEN;
+    t->tickUs    = 950;
+    box.commit();
+    box.freeze(BLACKBOX_REQUEST);
+
+    std::vector<BinaryLog_Sample> got = download();
+    ASSERT_EQ(got.size(), 1u);
+    const BinaryLog_Sample& s = got[0];
+    EXPECT_EQ(s.v[BLOG_TIME_MS], 1234);
+    EXPECT_EQ(s.v[BLOG_PITCH], -1235);
+    EXPECT_EQ(s.v[BLOG_GYRO_Z], 0);
+    EXPECT_EQ(s.v[BLOG_ACC_Z], 16384);
+    EXPECT_EQ(s.v[BLOG_BASE_SPEED], 2500);
+    EXPECT_EQ(s.v[BLOG_LEFT_SPEED], -801);
+    EXPECT_EQ(s.v[BLOG_LEFT_POS], 1 << 30);
+    EXPECT_EQ(s.v[BLOG_CMD_STEER], 42);
+    EXPECT_EQ(s.v[BLOG_FLAGS], TELEM_FALLEN);
+    EXPECT_EQ(s.v[BLOG_TICK_US], 950);
+}
+
+TEST_F(BlackBox, ArmRefusedDuringDownload) {
+    record(10);
+    box.freeze(BLACKBOX_REQUEST);
+
+    AsyncWebServerRequest dl("/blackbox");
+    server.handle(dl);
+    AsyncWebServerRequest arm("/blackbox/arm");
+    server.handle(arm);
+    EXPECT_EQ(arm.code(), 409);
+    EXPECT_EQ(arm.body(), "download in progress");
+
+    dl.disconnect();
+    AsyncWebServerRequest again("/blackbox/arm");
+    server.handle(again);
+    EXPECT_EQ(again.code(), 200);
+    EXPECT_EQ(again.body(), "OK");
+    EXPECT_FALSE(box.isFrozen());
+}
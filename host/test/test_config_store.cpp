@@ -0,0 +1,103 @@
+// RobotConfig_Store: blob у файловій заміні NVS, /config/save лише коли робот не балансує
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "RobotConfig_Store.h"
+
+namespace {
+
+struct ConfigStore : ::testing::Test {
+    AsyncWebServer server{80};
+
+    void SetUp() override { remove(HostPreferences::pathFor("robot").c_str()); }
+    void TearDown() override { remove(HostPreferences::pathFor("robot").c_str()); }
+
+    int get(const char* target) {
+        AsyncWebServerRequest req(target);
+        server.handle(req);
+        return req.code();
+    }
+};
+
+}
+
+
+// Зміна через HTTP -> /config/save -> новий об'єкт (як після перезавантаження) читає її
+TEST_F(ConfigStore, RoundTripThroughFile) {
+    {
+        RobotConfig_Store store(&server);
+        store.load();
+        store.begin();
+        EXPECT_EQ(get("/config/set?innerKp=650&fallAngle=35&bootCalibrate=1"), 200);
+        EXPECT_EQ(get("/config/save"), 200);
+    }
+
+    AsyncWebServer other(80);
+    RobotConfig_Store again(&other);
+    again.load();
+    EXPECT_FLOAT_EQ(again.get().innerKp, 650.0f);
+    EXPECT_FLOAT_EQ(again.get().fallAngle, 35.0f);
+    EXPECT_TRUE(again.get().flags & CONFIG_BOOT_CALIBRATE);
+    EXPECT_FLOAT_EQ(again.get().innerKi, RobotConfigFormat::defaults().innerKi);
+}
+
+// Пошкоджений blob: CRC не збігається — значення за замовчуванням
+TEST_F(ConfigStore, CorruptBlobFallsBackToDefaults) {
+    {
+        RobotConfig_Store store(&server);
+        store.load();
+        store.begin();
+        get("/config/set?innerKp=650");
+        get("/config/save");
+    }
+    FILE* f = fopen(HostPreferences::pathFor("robot").c_str(), "r+b");
+    ASSERT_NE(f, nullptr);
+    fseek(f, -3, SEEK_END);
+    fputc(0x5A, f);
+    fclose(f);
+
+    RobotConfig_Store again(&server);
+    again.load();
+    EXPECT_FLOAT_EQ(again.get().innerKp, RobotConfigFormat::defaults().innerKp);
+}
+
+TEST_F(ConfigStore, SaveRefusedWhileBalancing) {
+    RobotConfig_Store store(&server);
+    store.load();
+    store.begin();
+    uint32_t writes = HostPreferences::writes();
+
+    store.setSaveAllowed(false);
+    AsyncWebServerRequest req("/config/save");
+    server.handle(req);
+    EXPECT_EQ(req.code(), 409);
+    EXPECT_EQ(HostPreferences::writes(), writes);
+
+    store.setSaveAllowed(true);
+    EXPECT_EQ(get("/config/save"), 200);
+    EXPECT_EQ(HostPreferences::writes(), writes + 1);
+}
+
+// Погане значення чи невідоме ім'я: 400 з іменем параметра, нічого не змінено
+TEST_F(ConfigStore, RejectsBadParameterByName) {
+    RobotConfig_Store store(&server);
+    store.begin();
+
+    AsyncWebServerRequest bad("/config/set?innerKp=700&fallAngle=abc");
+    server.handle(bad);
+    EXPECT_EQ(bad.code(), 400);
+    EXPECT_EQ(bad.body(), "fallAngle");
+    EXPECT_EQ(bad.response()->contentType, "text/plain");
+    EXPECT_FLOAT_EQ(store.get().innerKp, RobotConfigFormat::defaults().innerKp);
+
+    AsyncWebServerRequest unknown("/config/set?bogus=1");
+    server.handle(unknown);
+    EXPECT_EQ(unknown.code(), 400);
+    EXPECT_EQ(unknown.body(), "bogus");
+
+    AsyncWebServerRequest json("/config");
+    server.handle(json);
+    EXPECT_EQ(json.response()->contentType, "application/json");
+}
@@ -0,0 +1,130 @@
+// ControlCore: такт без заліза — входи із запису, deadman, падіння
+
+#include <gtest/gtest.h>
+
+#include "ControlTick_Core.h"
+
+namespace {
+
+struct Core : ::testing::Test {
+    BalanceController  balance;
+    SteeringController steering;
+    ControlCore        core{balance, steering};
+
+    void SetUp() override {
+        core.applyConfig(RobotConfigFormat::defaults());
+        core.begin(0, 0, 0);
+    }
+
+    ControlInputs inputs(unsigned long now, float pitch) {
+        ControlInputs in = {};
+        in.now       = now;
+        in.pitch     = pitch;
+        in.cmd       = { STOP, 150, 50 };
+        in.linkAlive = true;
+        return in;
+    }
+};
+
+}
+
+
+TEST(ControlCoreSample, FromSampleRestoresInputs) {
+    BinaryLog_Sample s;
+    s.clear();
+    s.v[BLOG_TIME_MS] = 1230;
+    s.set(BLOG_PITCH, -2.5f);
+    s.set(BLOG_GYRO_Z, 12.0f);
+    s.v[BLOG_LEFT_POS]  = -4000;
+    s.v[BLOG_RIGHT_POS] = 3990;
+    s.v[BLOG_CMD_DIR]   = BACKWARD_LEFT;
+    s.v[BLOG_CMD_SPEED] = 200;
+    s.v[BLOG_CMD_STEER] = 20;
+    s.v[BLOG_FLAGS]     = TELEM_LINK_LOST;
+
+    ControlInputs in = ControlCore::fromSample(s);
+    EXPECT_EQ(in.now, 1230u);
+    EXPECT_FLOAT_EQ(in.pitch, -2.5f);
+    EXPECT_FLOAT_EQ(in.gyroZ, 12.0f);
+    EXPECT_EQ(in.leftPos, -4000);
+    EXPECT_EQ(in.rightPos, 3990);
+    EXPECT_EQ(in.cmd.direction, BACKWARD_LEFT);
+    EXPECT_EQ(in.cmd.speed, 200);
+    EXPECT_EQ(in.cmd.steer, 20);
+    EXPECT_FALSE(in.linkAlive);
+}
+
+// Колеса в gyroWeight < 1: позиції зі входів доходять до SteeringController
+TEST_F(Core, WheelPositionsFeedSteering) {
+    steering.setGyroWeight(0.0f);
+    ControlOutputs out;
+    ControlInputs in = inputs(10, 0.0f);
+    in.leftPos  = -50;
+    in.rightPos = -50;
+    core.step(in, out);
+    EXPECT_NE(steering.getMeasuredRate(), 0.0f);
+}
+
+TEST_F(Core, FallZeroesWheelsOnce) {
+    ControlOutputs out;
+    core.step(inputs(10, 60.0f), out);
+    EXPECT_TRUE(out.fell);
+    EXPECT_TRUE(core.fallen);
+    EXPECT_EQ(out.leftSpeed, 0.0f);
+    EXPECT_EQ(out.rightSpeed, 0.0f);
+
+    core.step(inputs(20, 60.0f), out);
+    EXPECT_FALSE(out.fell);
+}
+
+TEST_F(Core, LinkLossRampsTargetDown) {
+    ControlOutputs out;
+    ControlInputs in = inputs(10, 0.0f);
+    in.cmd = { FORWARD, 51, 50 };             // 0.2 · maxSpeed = 10000
+    core.step(in, out);
+    EXPECT_FLOAT_EQ(out.targetSpeed, 10000.0f);
+
+    in.linkAlive = false;
+    in.now = 20;
+    core.step(in, out);
+    EXPECT_TRUE(out.linkDropped);
+    EXPECT_LT(out.targetSpeed, 10000.0f);
+    EXPECT_EQ(out.cmd.steer, 50);
+
+    for (int i = 0; i < 100; i++) { in.now += 10; core.step(in, out); }
+    EXPECT_EQ(out.targetSpeed, 0.0f);
+    EXPECT_FALSE(out.linkDropped);
+}
+
+// Цільова швидкість може бути більшою за межу балансу (50000 проти 15000):
+// рампа стартує з межі, а не витрачає секунди на недосяжну частину
+TEST_F(Core, RampStartsFromBalanceLimit) {
+    ControlOutputs out;
+    ControlInputs in = inputs(10, 0.0f);
+    in.cmd = { FORWARD, 255, 50 };
+    core.step(in, out);
+    EXPECT_FLOAT_EQ(out.targetSpeed, 50000.0f);
+
+    in.linkAlive = false;
+    in.now = 20;
+    core.step(in, out);
+    EXPECT_FLOAT_EQ(out.targetSpeed, balance.getMaxSpeed() - core.linkLossDecel * 0.01f);
+}
+
+// До першої команди сторінки зв'язку немає — це не "втрата"
+TEST_F(Core, NoLinkDropAtBoot) {
+    ControlOutputs out;
+    ControlInputs in = inputs(10, 0.0f);
+    in.linkAlive = false;
+    core.step(in, out);
+    EXPECT_FALSE(out.linkDropped);
+    EXPECT_TRUE(core.linkLost);
+
+    in.linkAlive = true;
+    in.now = 20;
+    core.step(in, out);
+    in.linkAlive = false;
+    in.now = 30;
+    core.step(in, out);
+    EXPECT_TRUE(out.linkDropped);
+}
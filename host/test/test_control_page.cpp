@@ -0,0 +1,121 @@
+// Головна сторінка: gzip з flash, ETag і 304, вміст після розпакування,
+// модель часу до першого рендера на слабкому каналі AP
+
+#include <gtest/gtest.h>
+
+#include <zlib.h>
+
+#include "ControlPage_Routes.h"
+#include "ControlPage_WebPage.h"
+#include "ControlPage_WebPageGz.h"
+
+namespace {
+
+struct ControlPage : ::testing::Test {
+    AsyncWebServer     server{80};
+    ControlPage_Router router{&server};
+
+    void SetUp() override {
+        router.setupRoutes(ControlPage_Asset{ controlPageGz, sizeof(controlPageGz), controlPageETag });
+    }
+};
+
+std::string gunzip(const std::string& gz) {
+    z_stream z = {};
+    EXPECT_EQ(inflateInit2(&z, 16 + MAX_WBITS), Z_OK);
+    z.next_in  = (Bytef*)gz.data();
+    z.avail_in = gz.size();
+    std::string out;
+    char buf[4096];
+    int rc;
+    do {
+        z.next_out  = (Bytef*)buf;
+        z.avail_out = sizeof(buf);
+        rc = inflate(&z, Z_NO_FLUSH);
+        out.append(buf, sizeof(buf) - z.avail_out);
+    } while (rc == Z_OK);
+    EXPECT_EQ(rc, Z_STREAM_END);
+    inflateEnd(&z);
+    return out;
+}
+
+// Час до першого рендера: TCP-з'єднання + запит, відповідь сегментами
+// по MSS з повільним стартом (початкове вікно 2 сегменти, подвоюється
+// щораунду); раунд триває RTT або час передачі вікна, що довше.
+// Скрипт у кінці сторінки — рендер, коли прийшла вся відповідь
+double firstRenderMs(size_t bytes, double rttMs, double kbitPerSec) {
+    const size_t MSS = 1460;
+    double ms = rttMs;                               // SYN / SYN-ACK
+    size_t cwnd = 2, sent = 0;
+    do {
+        size_t chunk = std::min(bytes - sent, cwnd * MSS);
+        ms += std::max(rttMs, chunk * 8.0 / kbitPerSec);
+        sent += chunk;
+        cwnd *= 2;
+    } while (sent < bytes);
+    return ms;
+}
+
+}
+
+
+TEST_F(ControlPage, ServesGzipFromFlash) {
+    AsyncWebServerRequest req("/");
+    server.handle(req);
+    ASSERT_EQ(req.code(), 200);
+    AsyncWebServerResponse* res = req.response();
+    EXPECT_STREQ(res->header("Content-Encoding"), "gzip");
+    EXPECT_STREQ(res->header("ETag"), controlPageETag);
+    EXPECT_STREQ(res->header("Cache-Control"), "no-cache");
+
+    // Байти — ті самі, що у flash, без копії в RAM
+    EXPECT_EQ(res->progmem, controlPageGz);
+    EXPECT_EQ(res->progmemLength, sizeof(controlPageGz));
+    EXPECT_EQ(req.body().size(), sizeof(controlPageGz));
+}
+
+TEST_F(ControlPage, MatchingEtagGives304) {
+    AsyncWebServerRequest req("/");
+    req.header("If-None-Match", controlPageETag);
+    server.handle(req);
+    EXPECT_EQ(req.code(), 304);
+    EXPECT_TRUE(req.body().empty());
+    EXPECT_STREQ(req.response()->header("ETag"), controlPageETag);
+
+    AsyncWebServerRequest stale("/");
+    stale.header("If-None-Match", "\"0000000000000000\"");
+    server.handle(stale);
+    EXPECT_EQ(stale.code(), 200);
+}
+
+// Розпакована сторінка — мінімізоване джерело: ті самі маршрути й розмітка
+TEST_F(ControlPage, GunzipsToMinifiedSource) {
+    AsyncWebServerRequest req("/");
+    server.handle(req);
+    std::string html = gunzip(req.body());
+
+    EXPECT_LT(html.size(), strlen(controlPageHTML));
+    EXPECT_NE(html.find("<title>Balance Bot Controller</title>"), std::string::npos);
+    EXPECT_NE(html.find("move?v="), std::string::npos);
+    EXPECT_NE(html.find("&sid="), std::string::npos);
+    EXPECT_NE(html.find("</html>"), std::string::npos);
+}
+
+// Слабкий канал AP (RTT 40 мс, 250 кбіт/с): перше завантаження і повторне (304)
+TEST_F(ControlPage, FirstRenderGain) {
+    size_t raw = strlen(controlPageHTML);
+    size_t gz  = sizeof(controlPageGz);
+    double rawMs  = firstRenderMs(raw, 40, 250);
+    double gzMs   = firstRenderMs(gz, 40, 250);
+    double hitMs  = firstRenderMs(200, 40, 250);    // лише заголовки 304
+
+    RecordProperty("raw_bytes", (int)raw);
+    RecordProperty("gzip_bytes", (int)gz);
+    RecordProperty("raw_first_render_ms", (int)rawMs);
+    RecordProperty("gzip_first_render_ms", (int)gzMs);
+    RecordProperty("revalidate_ms", (int)hitMs);
+
+    EXPECT_LT(gz * 3, raw);
+    EXPECT_LT(gzMs, rawMs * 0.6);
+    EXPECT_LT(hitMs, gzMs);
+}
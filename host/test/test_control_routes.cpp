@@ -0,0 +1,120 @@
+// Розбір команд: ControlParse і маршрути ControlPage_Router через заміну веб-сервера
+
+#include <gtest/gtest.h>
+
+#include "ControlPage_Routes.h"
+
+namespace {
+
+const uint8_t PAGE[] = { 0x1f, 0x8b, 0x08 };
+const ControlPage_Asset ASSET = { PAGE, sizeof(PAGE), "\"test\"" };
+
+struct Routes : ::testing::Test {
+    AsyncWebServer     server{80};
+    ControlPage_Router router{&server};
+
+    void SetUp() override {
+        HostClock::setManual(true, 1000000);
+        router.setupRoutes(ASSET);
+    }
+    void TearDown() override { HostClock::setManual(false); }
+
+    int get(const char* target) {
+        AsyncWebServerRequest req(target);
+        server.handle(req);
+        return req.code();
+    }
+};
+
+}
+
+
+TEST(ControlParse, ParseLong) {
+    long v = 7;
+    EXPECT_TRUE(ControlParse::parseLong("42", v));   EXPECT_EQ(v, 42);
+    EXPECT_TRUE(ControlParse::parseLong("-1", v));   EXPECT_EQ(v, -1);
+    EXPECT_TRUE(ControlParse::parseLong("+3x", v));  EXPECT_EQ(v, 3);
+    EXPECT_FALSE(ControlParse::parseLong("x", v));
+    EXPECT_FALSE(ControlParse::parseLong("", v));
+    EXPECT_FALSE(ControlParse::parseLong(nullptr, v));
+    EXPECT_TRUE(ControlParse::parseLong("99999999999999999999999", v));
+    EXPECT_GT(v, 0);
+}
+
+TEST(ControlParse, DirectionNames) {
+    EXPECT_EQ(ControlParse::parseDirection("forward"),        FORWARD);
+    EXPECT_EQ(ControlParse::parseDirection("backward_right"), BACKWARD_RIGHT);
+    EXPECT_EQ(ControlParse::parseDirection("sideways"),       STOP);
+}
+
+TEST(ControlParse, MoveAxes) {
+    ControlCommand cmd = { STOP, 150, 50 };
+    ControlParse::applyMove(cmd, "1", "-1", "200");
+    EXPECT_EQ(cmd.direction, FORWARD_LEFT);
+    EXPECT_EQ(cmd.speed, 200);
+    EXPECT_EQ(cmd.steer, 0);
+
+    // Відсутні v/h — стоп, швидкість лишається; значення поза межами обрізаються
+    ControlParse::applyMove(cmd, nullptr, nullptr, nullptr);
+    EXPECT_EQ(cmd.direction, STOP);
+    EXPECT_EQ(cmd.speed, 200);
+    EXPECT_EQ(cmd.steer, 50);
+
+    ControlParse::applyMove(cmd, "-5", "9", "1000");
+    EXPECT_EQ(cmd.direction, BACKWARD_RIGHT);
+    EXPECT_EQ(cmd.speed, 255);
+    EXPECT_EQ(cmd.steer, 100);
+}
+
+
+TEST_F(Routes, MoveUpdatesCommand) {
+    EXPECT_EQ(get("/move?v=1&h=1&s=90&n=1"), 200);
+    ControlCommand cmd = router.getCommand();
+    EXPECT_EQ(cmd.direction, FORWARD_RIGHT);
+    EXPECT_EQ(cmd.speed, 90);
+    EXPECT_EQ(cmd.steer, 100);
+}
+
+// Keep-alive з тією самою командою не пише в журнал
+TEST_F(Routes, MoveLogsOnlyChanges) {
+    get("/move?v=1&h=0&s=90&n=1");
+    uint32_t pressure = Log().getSuppressed() + Log().getDropped();
+    for (int n = 2; n < 60; n++) {
+        char target[48];
+        snprintf(target, sizeof(target), "/move?v=1&h=0&s=90&n=%d", n);
+        get(target);
+    }
+    EXPECT_EQ(Log().getSuppressed() + Log().getDropped(), pressure);
+}
+
+TEST_F(Routes, SlidersClamp) {
+    get("/speed?val=300");
+    get("/steer?val=-4");
+    EXPECT_EQ(router.getCommand().speed, 255);
+    EXPECT_EQ(router.getCommand().steer, 0);
+
+    // Не число — команда не змінюється
+    get("/speed?val=abc");
+    EXPECT_EQ(router.getCommand().speed, 255);
+}
+
+TEST_F(Routes, DirectionRoute) {
+    get("/direction?val=backward_left");
+    EXPECT_EQ(router.getCommand().direction, BACKWARD_LEFT);
+    get("/direction?val=bogus");
+    EXPECT_EQ(router.getCommand().direction, STOP);
+}
+
+TEST_F(Routes, PageEtag) {
+    AsyncWebServerRequest full("/");
+    server.handle(full);
+    EXPECT_EQ(full.code(), 200);
+    EXPECT_STREQ(full.response()->header("Content-Encoding"), "gzip");
+    EXPECT_EQ(full.body().size(), sizeof(PAGE));
+
+    AsyncWebServerRequest cached("/");
+    cached.header("If-None-Match", "\"test\"");
+    server.handle(cached);
+    EXPECT_EQ(cached.code(), 304);
+    EXPECT_TRUE(cached.body().empty());
+}
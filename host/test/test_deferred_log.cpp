@@ -0,0 +1,159 @@
+// DeferredLog_Manager: обмеження частоти, лічильники втрат, вартість виклику під потоком повідомлень
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "DeferredLog_Manager.h"
+
+namespace {
+
+// Фонове завдання живе до кінця процесу, тож лог і порт — теж
+struct Sink {
+    HardwareSerial*      port;
+    DeferredLog_Manager* log;
+};
+
+Sink startSink(unsigned long baud) {
+    HostTasks::setEnabled(true);
+    Sink s{ new HardwareSerial(), new DeferredLog_Manager() };
+    if (baud) s.port->begin(baud);
+    s.log->begin(*s.port);
+    return s;
+}
+
+// Чекаємо, поки фонове завдання спорожнить кільце
+void waitDrained(const DeferredLog_Manager& log) {
+    uint32_t last = log.getWritten();
+    for (int idle = 0; idle < 20; ) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        uint32_t now = log.getWritten();
+        idle = (now == last) ? idle + 1 : 0;
+        last = now;
+    }
+}
+
+size_t countLines(const std::string& out, const char* needle) {
+    size_t n = 0;
+    for (size_t pos = 0; (pos = out.find(needle, pos)) != std::string::npos; pos++) n++;
+    return n;
+}
+
+double percentile(std::vector<double> v, double p) {
+    std::sort(v.begin(), v.end());
+    return v[(size_t)(p * (v.size() - 1))];
+}
+
+}
+
+
+TEST(DeferredLog, LevelFilter) {
+    DeferredLog_Manager log;
+    LogRateLimit rl;
+    log.setLevel(LOG_LEVEL_WARN);
+    EXPECT_TRUE(log.enabled(LOG_LEVEL_ERROR));
+    EXPECT_FALSE(log.enabled(LOG_LEVEL_INFO));
+
+    log.write(LOG_LEVEL_DEBUG, rl, "debug %d", 1);
+    log.write(LOG_LEVEL_INFO, rl, "info %d", 2);
+    EXPECT_EQ(rl.count, 0);
+    EXPECT_EQ(log.getSuppressed(), 0u);
+    EXPECT_EQ(log.getDropped(), 0u);
+}
+
+// Без фонового завдання кільце не спорожнюється: після RING_SIZE
+// повідомлень кожне наступне — втрачене, а не очікування
+TEST(DeferredLog, FullRingCountsDropped) {
+    DeferredLog_Manager log;
+    std::vector<LogRateLimit> sites(100);
+    for (LogRateLimit& rl : sites) log.write(LOG_LEVEL_WARN, rl, "site %p", (void*)&rl);
+
+    EXPECT_EQ(log.getDropped(), 100u - DeferredLog_Manager::RING_SIZE);
+    EXPECT_EQ(log.getSuppressed(), 0u);
+}
+
+// Одне місце виклику: LOG_RATE_PER_SEC за секунду, решта — у "(+N suppressed)"
+// наступного повідомлення, що пройшло
+TEST(DeferredLog, RateLimitPerCallSite) {
+    Sink s = startSink(0);
+    HostClock::setManual(true, 5000000);
+    LogRateLimit rl, other;
+
+    for (int i = 0; i < 100; i++) s.log->write(LOG_LEVEL_WARN, rl, "fell %d", i);
+    s.log->write(LOG_LEVEL_WARN, other, "other site");
+    EXPECT_EQ(s.log->getSuppressed(), 100u - DeferredLog_Manager::LOG_RATE_PER_SEC);
+
+    HostClock::advanceMicros(1000000);
+    s.log->write(LOG_LEVEL_WARN, rl, "fell again");
+    waitDrained(*s.log);
+    HostClock::setManual(false);
+
+    std::string out = s.port->output();
+    EXPECT_EQ(countLines(out, "\n"), DeferredLog_Manager::LOG_RATE_PER_SEC + 2u) << out;
+    EXPECT_NE(out.find("other site\n"), std::string::npos) << out;
+    EXPECT_NE(out.find("fell again (+95 suppressed)\n"), std::string::npos) << out;
+    EXPECT_EQ(s.log->getDropped(), 0u);
+}
+
+// Потік повідомлень на 115200 бод: прямий запис у Serial чекає UART,
+// відкладений виклик — ні; кожне втрачене повідомлення видно в лічильнику
+// і в рядку "messages dropped"
+TEST(DeferredLog, FloodLatency) {
+    using Clock = std::chrono::steady_clock;
+    const char* text = "balance: pitch=%+6.2f speed=%+6d loop=%4u us";
+
+    HardwareSerial direct;
+    direct.begin(115200);
+    std::vector<double> directUs;
+    char line[128];
+    for (int i = 0; i < 40; i++) {
+        int n = snprintf(line, sizeof(line), text, i * 0.1, i * 10, 2500u);
+        line[n++] = '\n';
+        Clock::time_point t0 = Clock::now();
+        direct.write((const uint8_t*)line, n);
+        directUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+    }
+
+    Sink s = startSink(115200);
+    const int calls = 2000;
+    std::vector<LogRateLimit> sites(calls);   // кожне — окреме місце виклику
+    std::vector<double> deferredUs;
+    for (int i = 0; i < calls; i++) {
+        Clock::time_point t0 = Clock::now();
+        s.log->write(LOG_LEVEL_WARN, sites[i], text, i * 0.1, i * 10, 2500u);
+        deferredUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+    }
+
+    double directMedian   = percentile(directUs, 0.5);
+    double deferredMedian = percentile(deferredUs, 0.5);
+    RecordProperty("direct_median_us",   std::to_string(directMedian));
+    RecordProperty("deferred_median_us", std::to_string(deferredMedian));
+    RecordProperty("deferred_p99_us",    std::to_string(percentile(deferredUs, 0.99)));
+    RecordProperty("dropped",            std::to_string(s.log->getDropped()));
+
+    // ~60 байт на 11520 Б/с — близько 5 мс на рядок, коли TX-буфер повний
+    EXPECT_GT(directMedian, 1000.0);
+    EXPECT_LT(deferredMedian, 50.0);
+    EXPECT_LT(deferredMedian * 20, directMedian);
+
+    waitDrained(*s.log);
+    uint32_t dropped = s.log->getDropped();
+    EXPECT_GT(dropped, 0u);
+    EXPECT_EQ(s.log->getSuppressed(), 0u);
+
+    // Усі повідомлення або в порту, або в лічильнику втрат
+    std::string out = s.port->output();
+    size_t reports = countLines(out, "messages dropped");
+    size_t printed = countLines(out, "\n") - reports;
+    EXPECT_EQ(printed + dropped, (size_t)calls);
+    EXPECT_EQ(s.log->getWritten(), printed + reports);
+
+    uint32_t reported = 0;
+    for (size_t pos = 0; (pos = out.find(" W log: ", pos)) != std::string::npos; pos++) {
+        reported += strtoul(out.c_str() + pos + 8, nullptr, 10);
+    }
+    EXPECT_EQ(reported, dropped);
+}
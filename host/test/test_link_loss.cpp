@@ -0,0 +1,89 @@
+// Deadman на цілому RobotController: /move через фейковий веб-сервер на
+// ручному часі, реакція на тишу — у межах linkTimeoutMs + один такт
+
+#include <gtest/gtest.h>
+
+#include "Robot_Sim.h"
+
+namespace {
+
+// Сторінка повторює /move кожні KEEPALIVE_MS, навіть без змін (ControlPage_WebPage.h)
+constexpr uint32_t KEEPALIVE_MS = 200;
+
+struct LinkLoss : ::testing::Test {
+    RobotSim::Rig rig;
+    uint32_t      seq = 0;
+    unsigned long lastMoveMs = 0;
+
+    void SetUp() override { rig.begin(); }
+
+    void move(int v, int speed) {
+        char target[64];
+        snprintf(target, sizeof(target), "/move?v=%d&h=0&s=%d&sid=7&n=%lu", v, speed, (unsigned long)++seq);
+        ASSERT_EQ(rig.get(target), 200);
+        lastMoveMs = millis();
+    }
+
+    // Команди кожні periodMs протягом ms
+    void drive(int v, int speed, uint32_t ms, uint32_t periodMs = KEEPALIVE_MS) {
+        for (uint32_t t = 0; t < ms; t += periodMs) {
+            move(v, speed);
+            rig.run(periodMs);
+        }
+    }
+};
+
+}
+
+
+TEST_F(LinkLoss, RampStartsWithinTimeoutPlusTick) {
+    drive(1, 255, 2000);
+    ASSERT_FALSE(rig.robot.core.linkLost);
+    float cruise = rig.balance.getTargetSpeed();
+    ASSERT_GT(cruise, 0.0f);
+
+    // Остання команда — і тиша
+    move(1, 255);
+    unsigned long rampMs = 0, stopMs = 0;
+    rig.run(5000, [&]() {
+        if (!rampMs && rig.robot.core.linkLost) rampMs = millis();
+        if (rampMs && rig.balance.getTargetSpeed() == 0.0f) stopMs = millis();
+        return stopMs != 0;
+    });
+    ASSERT_NE(rampMs, 0ul);
+    ASSERT_NE(stopMs, 0ul);
+
+    unsigned long reactionMs = rampMs - lastMoveMs;
+    RecordProperty("reaction_ms", (int)reactionMs);
+    EXPECT_GE(reactionMs, rig.robot.linkTimeoutMs);
+    EXPECT_LE(reactionMs, rig.robot.linkTimeoutMs + ControlCore::PID_INTERVAL_MS);
+
+    // Гальмування по профілю linkLossDecel, а не обрив
+    float expectedMs = cruise / rig.robot.core.linkLossDecel * 1000.0f;
+    RecordProperty("ramp_ms", (int)(stopMs - rampMs));
+    EXPECT_NEAR((float)(stopMs - rampMs), expectedMs, 2.0f * ControlCore::PID_INTERVAL_MS);
+}
+
+// Keep-alive без змін команди тримає зв'язок; пропуск одного пакета — теж
+TEST_F(LinkLoss, KeepAliveHoldsLink) {
+    drive(0, 150, 3000);
+    EXPECT_FALSE(rig.robot.core.linkLost);
+
+    move(0, 150);
+    rig.run(2 * KEEPALIVE_MS);
+    EXPECT_FALSE(rig.robot.core.linkLost);
+    drive(0, 150, 3000);
+    EXPECT_FALSE(rig.robot.core.linkLost);
+}
+
+// Зв'язок повернувся: рампа скасовується першою ж командою
+TEST_F(LinkLoss, CommandAfterLossResumes) {
+    drive(1, 200, 1000);
+    rig.run(rig.robot.linkTimeoutMs + 50);
+    ASSERT_TRUE(rig.robot.core.linkLost);
+
+    move(1, 200);
+    rig.run(ControlCore::PID_INTERVAL_MS + 1);
+    EXPECT_FALSE(rig.robot.core.linkLost);
+    EXPECT_GT(rig.balance.getTargetSpeed(), 0.0f);
+}
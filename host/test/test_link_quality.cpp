@@ -0,0 +1,83 @@
+// LinkQuality_Monitor: втрати та перестановки по seq у межах сеансу сторінки
+
+#include <gtest/gtest.h>
+
+#include "ControlPage_Routes.h"
+
+namespace {
+
+const uint32_t IP = 0x0204A8C0;     // 192.168.4.2, як AsyncClient у заміні
+
+}
+
+
+TEST(LinkQuality, GapCountsLost) {
+    LinkQuality_Monitor m;
+    m.onCommand(IP, 7, 1, 0);
+    m.onCommand(IP, 7, 2, 200);
+    m.onCommand(IP, 7, 5, 400);
+    m.onCommand(IP, 7, 4, 450);
+    const auto* c = m.findClient(IP);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c->lost, 2u);
+    EXPECT_EQ(c->reordered, 1u);
+    EXPECT_EQ(c->received, 3u);
+}
+
+// Переставлений пакет теж зсуває час останнього прибуття: інтервали
+// навколо нього — між сусідніми пакетами, а не від пакета до нього
+TEST(LinkQuality, ReorderedPacketKeepsArrivalIntervals) {
+    LinkQuality_Monitor m;
+    m.onCommand(IP, 7, 1, 0);
+    m.onCommand(IP, 7, 3, 200);
+    m.onCommand(IP, 7, 2, 210);
+    m.onCommand(IP, 7, 4, 400);
+    const auto* c = m.findClient(IP);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c->reordered, 1u);
+    EXPECT_EQ(c->interArrivalMs.total, 3u);
+    EXPECT_EQ(c->interArrivalMs.sum, 400);          // 200 + 10 + 190
+    EXPECT_EQ(c->interArrivalMs.maxValue, 200);
+    EXPECT_EQ(c->interArrivalMs.minValue, 10);
+}
+
+// Перезавантаження: новий sid, seq знову з 1 — не перестановки
+TEST(LinkQuality, ReloadStartsNewSession) {
+    LinkQuality_Monitor m;
+    for (uint32_t n = 1; n <= 50; n++) m.onCommand(IP, 111, n, n * 200);
+    for (uint32_t n = 1; n <= 20; n++) m.onCommand(IP, 222, n, 20000 + n * 200);
+
+    const auto* c = m.findClient(IP);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c->received, 70u);
+    EXPECT_EQ(c->reordered, 0u);
+    EXPECT_EQ(c->lost, 0u);
+    EXPECT_EQ(c->sessions, 2u);
+}
+
+TEST(LinkQuality, RouteForwardsSid) {
+    static const uint8_t page[] = { 0 };
+    HostClock::setManual(true, 1000000);
+    AsyncWebServer server(80);
+    ControlPage_Router router(&server);
+    router.setupRoutes(ControlPage_Asset{ page, sizeof(page), "\"x\"" });
+
+    char target[64];
+    for (int n = 1; n <= 30; n++) {
+        snprintf(target, sizeof(target), "/move?v=0&h=0&s=150&sid=5&n=%d", n);
+        AsyncWebServerRequest req(target);
+        server.handle(req);
+    }
+    for (int n = 1; n <= 3; n++) {
+        snprintf(target, sizeof(target), "/move?v=0&h=0&s=150&sid=6&n=%d", n);
+        AsyncWebServerRequest req(target);
+        server.handle(req);
+    }
+
+    AsyncWebServerRequest stats("/link");
+    server.handle(stats);
+    HostClock::setManual(false);
+
+    EXPECT_NE(stats.body().find("\"reordered\":0"), std::string::npos) << stats.body();
+    EXPECT_NE(stats.body().find("\"sessions\":2"), std::string::npos) << stats.body();
+}
@@ -0,0 +1,118 @@
+// LoopMetrics_Manager: маршрути /metrics і /metrics.json, скидання статистики,
+// кошики і квантилі CycleHistogram
+
+#include <gtest/gtest.h>
+
+#include "LoopMetrics_Manager.h"
+
+namespace {
+
+typedef StepperMotor_Controller<33, 14, 26> LeftMotor;
+typedef StepperMotor_Controller<32, 25, 27> RightMotor;
+
+struct Metrics : ::testing::Test {
+    AsyncWebServer      server{80};
+    LoopMetrics_Manager metrics{&server};
+    LeftMotor           left;
+    RightMotor          right;
+
+    void SetUp() override { metrics.begin(left, right); }
+};
+
+}
+
+
+TEST_F(Metrics, RoutesServeBothFormats) {
+    metrics.recordMicros(METRIC_TICK, 100);
+
+    AsyncWebServerRequest json("/metrics.json");
+    server.handle(json);
+    EXPECT_EQ(json.code(), 200);
+    EXPECT_EQ(json.response()->contentType, "application/json");
+    EXPECT_NE(json.body().find("\"tick\":["), std::string::npos) << json.body();
+    EXPECT_NE(json.body().find("\"left\":["), std::string::npos) << json.body();
+
+    AsyncWebServerRequest prom("/metrics");
+    server.handle(prom);
+    EXPECT_EQ(prom.response()->contentType, "text/plain; version=0.0.4");
+    EXPECT_NE(prom.body().find("robot_stage_us_count{stage=\"tick\"} 1"), std::string::npos) << prom.body();
+}
+
+// ?reset лише ставить прапорець: аналізатори кроків обнуляє такт керування
+TEST_F(Metrics, ResetDeferredToControlLoop) {
+    HostClock::setManual(true, 0);
+    left.begin();
+    left.setMotorEnable(true);
+    left.setSpeed(1000);
+    for (int i = 0; i < 5000; i++) {
+        left.run();
+        HostClock::advanceMicros(1);
+    }
+    ASSERT_GT(left.getTiming().getSteps(), 0u);
+
+    AsyncWebServerRequest req("/metrics.json?reset=1");
+    server.handle(req);
+    EXPECT_GT(left.getTiming().getSteps(), 0u);
+
+    metrics.recordMicros(METRIC_STEPS, 1);
+    EXPECT_EQ(left.getTiming().getSteps(), 0u);
+    HostClock::setManual(false);
+}
+
+// Кошики — половини октави від 2^MIN_BIT: межа кошика b — перше значення b+1
+TEST(CycleHistogram, BucketEdges) {
+    EXPECT_EQ(CycleHistogram::bucketOf(0), 0u);
+    EXPECT_EQ(CycleHistogram::bucketOf(15), 0u);
+    EXPECT_EQ(CycleHistogram::bucketOf(16), 1u);
+    EXPECT_EQ(CycleHistogram::bucketOf(23), 1u);
+    EXPECT_EQ(CycleHistogram::bucketOf(24), 2u);
+    EXPECT_EQ(CycleHistogram::bucketOf(31), 2u);
+    EXPECT_EQ(CycleHistogram::bucketOf(32), 3u);
+    EXPECT_EQ(CycleHistogram::upperEdge(0), 16u);
+    EXPECT_EQ(CycleHistogram::upperEdge(1), 24u);
+    EXPECT_EQ(CycleHistogram::upperEdge(2), 32u);
+
+    for (size_t b = 0; b + 1 < CycleHistogram::BUCKETS; b++) {
+        uint32_t edge = CycleHistogram::upperEdge(b);
+        EXPECT_EQ(CycleHistogram::bucketOf(edge - 1), b) << b;
+        EXPECT_EQ(CycleHistogram::bucketOf(edge), b + 1) << b;
+    }
+    EXPECT_EQ(CycleHistogram::bucketOf(1u << CycleHistogram::MAX_BIT), CycleHistogram::BUCKETS - 1);
+    EXPECT_EQ(CycleHistogram::bucketOf(UINT32_MAX), CycleHistogram::BUCKETS - 1);
+    EXPECT_EQ(CycleHistogram::upperEdge(CycleHistogram::BUCKETS - 1), UINT32_MAX);
+}
+
+// Квантиль — верхня межа кошика: не менше точного і не більше ніж у 1.5 раза
+TEST(CycleHistogram, QuantileOfKnownDistributions) {
+    CycleHistogram h;
+    h.reset();
+    EXPECT_EQ(h.quantile(0.5f), 0u);
+
+    // Одне значення: межу кошика обрізає максимум
+    for (int i = 0; i < 100; i++) h.add(5000);
+    EXPECT_EQ(h.quantile(0.0f), 5000u);
+    EXPECT_EQ(h.quantile(0.99f), 5000u);
+
+    // Рівномірний 1000..1999
+    h.reset();
+    for (uint32_t v = 1000; v < 2000; v++) h.add(v);
+    EXPECT_EQ(h.total, 1000u);
+    EXPECT_EQ(h.sum, 1499500u);
+    EXPECT_EQ(h.quantile(0.0f), 1024u);
+    EXPECT_EQ(h.quantile(0.5f), 1536u);
+    EXPECT_EQ(h.quantile(0.99f), 1999u);
+    for (float q : { 0.1f, 0.25f, 0.5f, 0.75f, 0.9f }) {
+        uint32_t exact = 1000 + (uint32_t)(q * 1000);
+        EXPECT_GE(h.quantile(q), exact) << q;
+        EXPECT_LE(h.quantile(q), exact * 3 / 2) << q;
+    }
+
+    // 90% коротких тактів і 10% довгих: хвіст не зсуває медіану
+    h.reset();
+    for (int i = 0; i < 900; i++) h.add(100);
+    for (int i = 0; i < 100; i++) h.add(100000);
+    EXPECT_EQ(h.quantile(0.5f), 128u);
+    EXPECT_EQ(h.quantile(0.89f), 128u);
+    EXPECT_EQ(h.quantile(0.95f), 100000u);
+    EXPECT_EQ(h.maxCycles, 100000u);
+}
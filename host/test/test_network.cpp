@@ -0,0 +1,122 @@
+// NetworkConnection_Manager на фейковому WiFi: час до балансу, паузи і повільні повтори STA
+
+#include <gtest/gtest.h>
+
+#include "Robot_Sim.h"
+
+namespace {
+
+struct Network : ::testing::Test {
+    NetworkConnection_Manager net{"router", "pass", "robot", "robotpass", 10000};
+
+    void SetUp() override {
+        WiFi.reset();
+        HostClock::setManual(true, 0);
+    }
+    void TearDown() override { HostClock::setManual(false); }
+
+    // Завдання "wifi" на хості не запускається — крутимо автомат самі
+    void runFor(unsigned long ms) {
+        for (unsigned long t = 0; t < ms; t += NetworkConnection_Manager::SUPERVISE_PERIOD_MS) {
+            HostClock::advanceMicros(NetworkConnection_Manager::SUPERVISE_PERIOD_MS * 1000ul);
+            net.supervise(millis());
+        }
+    }
+};
+
+}
+
+
+// Роутера немає: robot.begin() не чекає STA, перший такт балансу —
+// у межах двох періодів PID після старту, поки спроба STA ще триває
+TEST(NetworkBoot, TimeToBalanceWithoutRouter) {
+    RobotSim::Rig rig(300);
+    unsigned long startMs = millis();
+    rig.begin();
+    EXPECT_EQ(millis(), startMs);          // begin() не блокує
+
+    rig.run(100, [&]() { return rig.robot.balancedMs != 0; });
+    ASSERT_NE(rig.robot.balancedMs, 0ul);
+    unsigned long timeToBalanceMs = rig.robot.balancedMs - startMs;
+    RecordProperty("time_to_balance_ms", (int)timeToBalanceMs);
+
+    EXPECT_LE(timeToBalanceMs, 2 * ControlCore::PID_INTERVAL_MS);
+    EXPECT_EQ(rig.network.getState(), WIFI_LINK_CONNECTING);
+    EXPECT_EQ(rig.network.getApReadyMs(), startMs);
+    EXPECT_STREQ(rig.network.getMode(), "AP");
+}
+
+TEST_F(Network, ConnectsInBackground) {
+    net.begin();
+    runFor(1500);
+    WiFi.fakeStaConnected();
+    runFor(100);
+    EXPECT_EQ(net.getState(), WIFI_LINK_CONNECTED);
+    EXPECT_EQ(net.getStaReadyMs(), 1600ul);
+    EXPECT_STREQ(net.getMode(), "AP+STA");
+}
+
+// Після MAX_FAILED_ATTEMPTS тайм-аутів — спроба раз на RETRY_MAX_MS,
+// радіо лишається в AP+STA
+TEST_F(Network, SlowsDownAfterFailedAttempts) {
+    net.begin();
+    runFor(5 * 10000 + 1000 + 2000 + 4000 + 8000 + 1000);
+    EXPECT_EQ(net.getState(), WIFI_LINK_BACKOFF);
+    EXPECT_EQ(WiFi.getMode(), WIFI_AP_STA);
+    EXPECT_EQ(WiFi.beginCalls, (uint32_t)NetworkConnection_Manager::MAX_FAILED_ATTEMPTS);
+
+    // Кожна наступна: пауза RETRY_MAX_MS + тайм-аут спроби
+    const uint32_t cycle = NetworkConnection_Manager::RETRY_MAX_MS + 10000;
+    runFor(3 * cycle);
+    EXPECT_EQ(WiFi.beginCalls, NetworkConnection_Manager::MAX_FAILED_ATTEMPTS + 3u);
+    EXPECT_STREQ(net.getMode(), "AP");
+}
+
+// Роутер з'явився після багатьох невдач: наступна спроба підключає STA
+TEST_F(Network, ReconnectsWhenRouterReturns) {
+    net.begin();
+    runFor(10 * 60000);
+    ASSERT_NE(net.getState(), WIFI_LINK_CONNECTED);
+
+    uint32_t before = WiFi.beginCalls;
+    runFor(NetworkConnection_Manager::RETRY_MAX_MS + 10000);
+    EXPECT_GT(WiFi.beginCalls, before);
+
+    // Роутер увімкнули: підключення — на найближчій спробі
+    for (int i = 0; i < 400 && net.getState() != WIFI_LINK_CONNECTING; i++) runFor(100);
+    ASSERT_EQ(net.getState(), WIFI_LINK_CONNECTING);
+    WiFi.fakeStaConnected();
+    runFor(100);
+    EXPECT_EQ(net.getState(), WIFI_LINK_CONNECTED);
+    EXPECT_STREQ(net.getMode(), "AP+STA");
+
+    // Після підключення паузи знову з RETRY_MIN_MS
+    WiFi.fakeStaDisconnected(8);
+    runFor(100);
+    EXPECT_EQ(net.getState(), WIFI_LINK_BACKOFF);
+    uint32_t calls = WiFi.beginCalls;
+    runFor(NetworkConnection_Manager::RETRY_MIN_MS);
+    EXPECT_EQ(WiFi.beginCalls, calls + 1);
+}
+
+// Телефон на AP: поточна спроба переривається, нових немає,
+// поки він не відключиться; перервані спроби не ведуть до відмови
+TEST_F(Network, ApClientPausesRetries) {
+    net.begin();
+    runFor(500);
+    WiFi.fakeStationJoin(-50);
+    runFor(100);
+    EXPECT_EQ(net.getState(), WIFI_LINK_PAUSED);
+    EXPECT_EQ(WiFi.disconnects, 1u);
+
+    runFor(300000);
+    EXPECT_EQ(WiFi.beginCalls, 1u);
+    EXPECT_EQ(net.getState(), WIFI_LINK_PAUSED);
+
+    WiFi.fakeStationLeave();
+    runFor(100);
+    EXPECT_EQ(net.getState(), WIFI_LINK_BACKOFF);
+    runFor(1000);
+    EXPECT_EQ(WiFi.beginCalls, 2u);
+    EXPECT_EQ(net.getState(), WIFI_LINK_CONNECTING);
+}
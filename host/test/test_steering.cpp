@@ -0,0 +1,43 @@
+// SteeringController: I-складова при зміні коефіцієнтів
+
+#include <gtest/gtest.h>
+
+#include "SteeringPID_Manager.h"
+
+namespace {
+
+SteeringController make() {
+    SteeringController s;
+    s.begin(0, 0, 0);
+    s.setEnabled(true);
+    return s;
+}
+
+}
+
+
+// Ki = 0 на ходу: накопичена складова лишається, вихід не стрибає
+TEST(Steering, GainChangeIsBumpless) {
+    SteeringController s = make();
+    s.setTargetRate(20.0f);
+    for (unsigned long t = 10; t <= 500; t += 10) s.update(0.0f, 0, 0, t);
+    float before = s.getSteerOffset();
+
+    s.setGains(1.0f, 0.0f);
+    s.update(0.0f, 0, 0, 510);
+    EXPECT_NEAR(s.getSteerOffset(), before, 1.0f);
+}
+
+TEST(Steering, IntegralClampedToMaxRate) {
+    SteeringController s = make();
+    s.setGains(0.0f, 50.0f);
+    s.setTargetRate(s.getMaxRate());
+    for (unsigned long t = 10; t <= 5000; t += 10) s.update(0.0f, 0, 0, t);
+    EXPECT_FLOAT_EQ(s.getSteerOffset(), 2000.0f);
+
+    // I = maxRate, не більше: розворот цілі одразу зменшує вихід
+    // (maxRate - 50·maxRate/2·0.01) - maxRate/2 = maxRate/4
+    s.setTargetRate(-s.getMaxRate() / 2);
+    s.update(0.0f, 0, 0, 5010);
+    EXPECT_NEAR(s.getSteerOffset(), 500.0f, 1.0f);
+}
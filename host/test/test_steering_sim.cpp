@@ -0,0 +1,127 @@
+// Поворот у замкненому контурі на моделі диференційного приводу:
+// різні діаметри коліс, знак gyroZ, злиття з різницею кроків
+
+#include <gtest/gtest.h>
+
+#include "ControlTick_Core.h"
+
+namespace {
+
+// Колеса з різними діаметрами; плата Z догори: поворот вправо
+// (за годинниковою, якщо дивитись згори) дає gyroZ < 0
+struct DiffDrive {
+    float  leftDiameterMm  = 65.0f;
+    float  rightDiameterMm = 65.0f;
+    float  trackMm         = 180.0f;
+    float  stepsPerRev     = 3200.0f;
+    double leftPos  = 0;               // як getPosition(): лівий мотор дзеркальний
+    double rightPos = 0;
+    float  yawRate  = 0;               // °/с, + = вправо
+
+    // leftSpeed/rightSpeed — кр/с "вперед", як ControlOutputs
+    void apply(float leftSpeed, float rightSpeed, float dt) {
+        float vL = leftSpeed  * PI * leftDiameterMm  / stepsPerRev;
+        float vR = rightSpeed * PI * rightDiameterMm / stepsPerRev;
+        yawRate   = (vL - vR) / trackMm * RAD_TO_DEG;
+        leftPos  -= leftSpeed  * dt;
+        rightPos += rightSpeed * dt;
+    }
+
+    float gyroZ() const { return -yawRate; }
+};
+
+struct SimRobot {
+    BalanceController  balance;
+    SteeringController steering;
+    ControlCore        core{balance, steering};
+    RobotConfig        config = RobotConfigFormat::defaults();
+    DiffDrive          drive;
+    float              maxAbsSteer = 0;
+
+    // Робот рівно стоїть (pitch 0), їде вперед; такт 10 мс, мотори
+    // отримують швидкості такту — гіроскоп бачить їх наступного такту.
+    // Повертає середню кутову швидкість за останню секунду
+    float run(uint8_t steer, float seconds = 5.0f) {
+        core.applyConfig(config);
+        core.begin(0, 0, 0);
+        float sum = 0;
+        int   ticks = (int)(seconds * 100), tail = 0;
+        for (int i = 1; i <= ticks; i++) {
+            ControlInputs in = {};
+            in.now       = i * ControlCore::PID_INTERVAL_MS;
+            in.gyroZ     = drive.gyroZ();
+            in.leftPos   = (long)drive.leftPos;
+            in.rightPos  = (long)drive.rightPos;
+            in.cmd       = { FORWARD, 60, steer };
+            in.linkAlive = true;
+            ControlOutputs out;
+            core.step(in, out);
+            drive.apply(out.leftSpeed, out.rightSpeed, ControlCore::PID_INTERVAL_MS / 1000.0f);
+            if (fabsf(out.steerOffset) > maxAbsSteer) maxAbsSteer = fabsf(out.steerOffset);
+            if (i > ticks - 100) { sum += drive.yawRate; tail++; }
+        }
+        return sum / tail;
+    }
+};
+
+}
+
+
+// Праве колесо на 5% менше: без зворотного зв'язку робот кружляє,
+// із гіроскопом їде прямо
+TEST(SteeringSim, AsymmetricWheelsDriveStraight) {
+    SimRobot open;
+    open.drive.rightDiameterMm = 61.75f;
+    open.config.steerKp = 0;
+    open.config.steerKi = 0;
+    float openLoop = open.run(50);
+    EXPECT_GT(fabsf(openLoop), 5.0f) << "модель має давати дрейф без контуру";
+
+    SimRobot closed;
+    closed.drive.rightDiameterMm = 61.75f;
+    float yaw = closed.run(50, 10.0f);
+    EXPECT_LT(fabsf(yaw), 0.1f);
+    EXPECT_LT(closed.maxAbsSteer, closed.config.maxSteer);
+}
+
+// steer 75 — половина maxRate вправо, з тим самим знаком у моделі
+TEST(SteeringSim, TracksCommandedRate) {
+    SimRobot r;
+    r.drive.rightDiameterMm = 61.75f;
+    float yaw = r.run(75);
+    float target = r.steering.getMaxRate() * 0.5f;
+    ASSERT_GT(target, 0.0f);
+    EXPECT_NEAR(yaw, target, target * 0.05f);
+}
+
+// Неправильний знак — додатний зворотний зв'язок: поворот упирається
+// в maxSteer, робот крутиться, хоча команда "прямо"
+TEST(SteeringSim, WrongGyroSignRunsAway) {
+    SimRobot r;
+    r.drive.rightDiameterMm = 61.75f;
+    r.config.gyroSign = 1.0f;
+    float yaw = r.run(50);
+    EXPECT_FLOAT_EQ(r.maxAbsSteer, r.config.maxSteer);
+    EXPECT_GT(fabsf(yaw), 10.0f);
+}
+
+// Лише колеса (gyroWeight 0): знак різниці кроків узгоджений з гіроскопом
+TEST(SteeringSim, WheelFeedbackMatchesGyroSign) {
+    SimRobot r;
+    r.config.gyroWeight = 0.0f;
+    float yaw = r.run(75);
+    float target = r.steering.getMaxRate() * 0.5f;
+    EXPECT_NEAR(yaw, target, target * 0.05f);
+}
+
+// Геометрія з конфігурації: та сама команда — та сама кутова швидкість
+// на іншому роботі, якщо геометрію задано правильно
+TEST(SteeringSim, GeometryFromConfig) {
+    SimRobot r;
+    r.config.wheelDiameterMm = r.drive.leftDiameterMm = r.drive.rightDiameterMm = 90.0f;
+    r.config.trackWidthMm    = r.drive.trackMm = 240.0f;
+    r.config.stepsPerRev     = r.drive.stepsPerRev = 1600.0f;
+    r.config.gyroWeight      = 0.0f;
+    float yaw = r.run(75);
+    EXPECT_NEAR(yaw, r.steering.getMaxRate() * 0.5f, r.steering.getMaxRate() * 0.025f);
+}
@@ -0,0 +1,132 @@
+// Затримки loop(): фронти STEP проти ідеальної послідовності і лічильники StepTiming_Analyzer;
+// те саме для RobotController, де затримка — всередині такту
+
+#include <gtest/gtest.h>
+
+#include "Robot_Sim.h"
+#include "StepLoop_Sim.h"
+
+namespace {
+
+typedef StepperMotor_Controller<33, 14, 26> LeftMotor;
+typedef StepperMotor_Controller<32, 25, 27> RightMotor;
+
+const uint32_t INTERVAL = 100;      // 10000 кр/с
+
+struct StepStall : ::testing::Test {
+    StepSim::Loop sim{5};
+    LeftMotor     left;
+    RightMotor    right;
+
+    void SetUp() override {
+        left.begin();
+        right.begin();
+        left.setMotorEnable(true);
+        right.setMotorEnable(true);
+        left.setSpeed(1000000 / INTERVAL);
+        right.setSpeed(1000000 / INTERVAL);
+    }
+};
+
+// Цілий RobotController: затримки всередині такту (mpu6050.update()),
+// фронти STEP проти швидкостей, які такт задав моторам
+struct StepStallRobot : ::testing::Test {
+    StepSim::Loop sim{5};           // першим: ручний час від нуля, запис GPIO
+    RobotSim::Rig rig;
+
+    void SetUp() override {
+        // Робот балансує: нахил коливається ±6° з періодом 400 мс
+        rig.mpu.onUpdate = [](MPU6050& m) {
+            const float AMP = 6.0f, W = 2.0f * (float)M_PI / 0.4f;
+            float t = HostClock::nowMicros() * 1e-6f;
+            m.angleY = AMP * sinf(W * t);
+            m.gyroY  = AMP * W * cosf(W * t);
+        };
+        rig.begin();
+        rig.run(200);
+    }
+};
+
+}
+
+
+TEST_F(StepStall, NoStallFollowsIdeal) {
+    sim.run(left, right, 100000);
+
+    StepSim::TrainDiff d = sim.compare(33, INTERVAL);
+    EXPECT_EQ(d.ideal, 1000u);
+    EXPECT_LE(abs(d.positionError), 1);
+    EXPECT_LE(d.maxLateMicros, 5u);                  // не більше одного проходу loop()
+    EXPECT_EQ(sim.compare(32, INTERVAL).produced, d.produced);
+
+    const StepTiming_Analyzer& t = left.getTiming();
+    EXPECT_EQ(t.getMissedSteps(), 0u);
+    EXPECT_EQ(t.getLateSteps(), 0u);
+    EXPECT_EQ(t.getPulseViolations(), 0u);
+}
+
+// Мотор не наздоганяє: кожна затримка — назавжди втрачені кроки,
+// і аналізатор на пристрої рахує їх так само, як порівняння фронтів
+TEST_F(StepStall, StallLosesSteps) {
+    sim.addStall(20000, 2000);
+    sim.addStall(60000, 550);
+    sim.run(left, right, 100000);
+
+    StepSim::TrainDiff d = sim.compare(33, INTERVAL);
+    EXPECT_NEAR(d.positionError, -25, 2);
+    EXPECT_GE(d.maxLateMicros, 2500u);
+
+    const StepTiming_Analyzer& t = left.getTiming();
+    EXPECT_NEAR((int)t.getMissedSteps(), -d.positionError, 2);
+    EXPECT_EQ(t.getLateSteps(), 2u);
+    EXPECT_GE(t.getMaxLateMicros(), 1900u);
+    EXPECT_NEAR(t.getPositionError(sim.getEndMicros()), d.positionError, 1.0);
+}
+
+// Ідеальна позиція понад 2^24 кроків не втрачає крок
+TEST(StepTiming, IdealPositionPast2to24) {
+    StepTiming_Analyzer t;
+    t.onCommand(0, 10001);
+    for (unsigned long s = 1; s <= 2000; s++) t.onCommand(s * 1000000ul, 10001);
+    EXPECT_NEAR(t.getPositionError(2000000000ul), -20002000.0, 0.5);
+}
+
+TEST_F(StepStallRobot, StepsFollowCommandedSpeed) {
+    sim.run(rig.robot, 400000);
+    ASSERT_FALSE(rig.robot.core.fallen);
+    ASSERT_GT(sim.getSpeeds(0).size(), 20u);         // швидкість змінюється щотакту
+
+    // Похибка — лише фаза на змінах швидкості, а не накопичення
+    StepSim::TrainDiff d = sim.compareCommanded(33, 0);
+    EXPECT_GT(d.ideal, 500u);
+    EXPECT_LE(abs(d.positionError), 3);
+    StepSim::TrainDiff r = sim.compareCommanded(32, 1);
+    EXPECT_EQ(r.ideal, d.ideal);
+    EXPECT_LE(abs(r.positionError), 3);
+}
+
+// Такт, що блокує loop(), забирає кроки з тієї швидкості, яку сам задав
+TEST_F(StepStallRobot, StallInTickLosesSteps) {
+    const uint32_t STALL = 3000;
+    sim.addStall(40000, STALL);
+    sim.addStall(180000, STALL);
+    sim.run(rig.robot, 400000);
+    ASSERT_FALSE(rig.robot.core.fallen);
+
+    // Очікувана втрата: задана на момент затримки швидкість × тривалість
+    float expected = 0;
+    for (uint32_t at : { 40000u, 180000u }) {
+        float v = 0;
+        for (const StepSim::SpeedChange& c : sim.getSpeeds(0)) {
+            if (c.atMicros - sim.getStartMicros() <= at) v = c.stepsPerSec;
+        }
+        expected += v * STALL * 1e-6f;
+    }
+    ASSERT_GT(expected, 15.0f);
+
+    // Допуск: фазова похибка без затримок (±3) і по кроку на затримку
+    StepSim::TrainDiff d = sim.compareCommanded(33, 0);
+    EXPECT_NEAR(-d.positionError, expected, 5.0f);
+    EXPECT_GE(d.maxLateMicros, STALL);
+    EXPECT_GT(rig.left.getTiming().getMissedSteps(), 0u);
+}
@@ -0,0 +1,142 @@
+// StepperMotor_Controller: мертва зона, межа швидкості, фронти STEP у часі
+
+#include <gtest/gtest.h>
+
+#include "SteperMotor_Controller.h"
+
+namespace {
+
+typedef StepperMotor_Controller<33, 14, 26> Motor;
+
+struct Stepper : ::testing::Test {
+    Motor motor;
+
+    void SetUp() override {
+        HostClock::setManual(true, 0);
+        HostGpio::reset();
+        motor.begin();
+        motor.setMotorEnable(true);
+    }
+    void TearDown() override { HostClock::setManual(false); }
+};
+
+}
+
+
+TEST_F(Stepper, SpeedLimits) {
+    motor.setSpeed(50);
+    EXPECT_FLOAT_EQ(motor.getSpeed(), 200.0f);     // мертва зона
+    motor.setSpeed(-80000);
+    EXPECT_FLOAT_EQ(motor.getSpeed(), 50000.0f);
+    motor.setSpeed(0);
+    EXPECT_FALSE(motor.isRunning());
+}
+
+TEST_F(Stepper, EdgesFollowInterval) {
+    motor.setSpeed(1000);                           // 1000 мкс між кроками
+    int rises = 0, falls = 0;
+    for (unsigned long t = 0; t <= 10002; t++) {    // кроки на 1000, 2000 ... 10000
+        StepEdge e = motor.pollStep(t);
+        if (e == STEP_EDGE_RISE) rises++;
+        if (e == STEP_EDGE_FALL) falls++;
+    }
+    EXPECT_EQ(rises, 10);
+    EXPECT_EQ(falls, 10);
+    EXPECT_EQ(motor.getPosition(), 10);
+}
+
+TEST_F(Stepper, DirectionAndEnablePins) {
+    motor.setDirection(ROTATE_BACKWARD);
+    EXPECT_FALSE(HostGpio::level(14));
+    motor.setDirection(ROTATE_FORWARD);
+    EXPECT_TRUE(HostGpio::level(14));
+    motor.setMotorEnable(false);                    // EN активний низьким
+    EXPECT_TRUE(HostGpio::level(26));
+}
+
+TEST_F(Stepper, RunWritesStepPin) {
+    motor.setSpeed(1000);
+    HostClock::advanceMicros(1000);
+    motor.run();
+    EXPECT_TRUE(HostGpio::level(33));
+    HostClock::advanceMicros(2);
+    motor.run();
+    EXPECT_FALSE(HostGpio::level(33));
+}
+
+// runSteppers: фронти обох моторів в одному банку — один запис на фронт
+TEST(RunSteppers, MergesEdgesInOneBank) {
+    HostClock::setManual(true, 0);
+    HostGpio::reset();
+    StepperMotor_Controller<33, 14, 26> left;
+    StepperMotor_Controller<32, 25, 27> right;
+    left.begin();
+    right.begin();
+    left.setMotorEnable(true);
+    right.setMotorEnable(true);
+    left.setSpeed(1000);
+    right.setSpeed(1000);
+
+    HostGpio::setRecording(true);
+    HostClock::advanceMicros(1000);
+    runSteppers(left, right);
+    HostClock::advanceMicros(2);
+    runSteppers(left, right);
+    HostGpio::setRecording(false);
+
+    const auto& log = HostGpio::log();
+    ASSERT_EQ(log.size(), 2u);
+    EXPECT_TRUE(log[0].set);
+    EXPECT_EQ(log[0].bank, 1);
+    EXPECT_EQ(log[0].mask, (1u << 1) | (1u << 0));
+    EXPECT_FALSE(log[1].set);
+    EXPECT_EQ(log[1].mask, (1u << 1) | (1u << 0));
+    HostClock::setManual(false);
+}
+
+// Один мотор піднімає STEP, інший опускає: set і clear з власними масками;
+// піни в різних банках — окремий запис на банк
+TEST(RunSteppers, RiseAndFallInSameCall) {
+    HostClock::setManual(true, 0);
+    HostGpio::reset();
+    StepperMotor_Controller<33, 14, 26> a;
+    StepperMotor_Controller<4, 16, 17>  b;
+    a.begin();
+    b.begin();
+    a.setMotorEnable(true);
+    b.setMotorEnable(true);
+    a.setSpeed(1000);
+    b.setSpeed(1000);
+
+    HostClock::advanceMicros(1000);
+    runSteppers(a, b);                     // обидва HIGH
+    EXPECT_TRUE(HostGpio::level(33));
+    EXPECT_TRUE(HostGpio::level(4));
+
+    b.setSpeed(0);                         // b опускає STEP одразу, a — ще тримає
+    HostGpio::setRecording(true);
+    runSteppers(a, b);
+    EXPECT_TRUE(HostGpio::level(33));
+    EXPECT_FALSE(HostGpio::level(4));
+
+    a.setSpeed(0);
+    b.setSpeed(1000);
+    HostClock::advanceMicros(1000);
+    runSteppers(a, b);                     // a вниз (банк 1), b вгору (банк 0)
+    HostGpio::setRecording(false);
+    EXPECT_FALSE(HostGpio::level(33));
+    EXPECT_TRUE(HostGpio::level(4));
+
+    const auto& log = HostGpio::log();
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_FALSE(log[0].set);
+    EXPECT_EQ(log[0].bank, 0);
+    EXPECT_EQ(log[0].mask, 1u << 4);
+    EXPECT_TRUE(log[1].set);
+    EXPECT_EQ(log[1].bank, 0);
+    EXPECT_EQ(log[1].mask, 1u << 4);
+    EXPECT_FALSE(log[2].set);
+    EXPECT_EQ(log[2].bank, 1);
+    EXPECT_EQ(log[2].mask, 1u << 1);
+    HostClock::setManual(false);
+}
@@ -0,0 +1,96 @@
+// Telemetry_Stream: відправка лише з контексту AsyncTCP (pull по WebSocket)
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Telemetry_Stream.h"
+
+namespace {
+
+struct Telemetry : ::testing::Test {
+    AsyncWebServer   server{80};
+    Telemetry_Stream stream{&server};
+    AsyncWebSocket*  ws = nullptr;
+
+    void SetUp() override {
+        stream.begin();
+        ws = server.findHandler<AsyncWebSocket>();
+        ASSERT_NE(ws, nullptr);
+        stream.setDecimation(1);
+    }
+
+    static uint16_t countIn(const std::string& msg) {
+        TelemetryBatchHeader h;
+        memcpy(&h, msg.data(), sizeof(h));
+        return h.count;
+    }
+};
+
+}
+
+
+TEST_F(Telemetry, NoListenersNoRecords) {
+    EXPECT_EQ(stream.beginRecord(), nullptr);
+    EXPECT_EQ(stream.getDropped(), 0u);
+}
+
+TEST_F(Telemetry, PullSendsQueuedBatches) {
+    AsyncWebSocketClient* c = ws->fakeConnect();
+    for (int i = 0; i < 20; i++) {
+        TelemetryRecord* r = stream.beginRecord();
+        ASSERT_NE(r, nullptr);
+        r->timeMs = i;
+        stream.commitRecord();
+    }
+    EXPECT_TRUE(c->messages.empty());        // без запиту нічого не йде
+
+    ws->fakeMessage(c->id(), "p");
+    ASSERT_EQ(c->messages.size(), 2u);       // 16 + 4
+    EXPECT_EQ(countIn(c->messages[0]), Telemetry_Stream::BATCH_RECORDS);
+    EXPECT_EQ(countIn(c->messages[1]), 4);
+    EXPECT_EQ(stream.getSent(), 20u);
+
+    // Інші текстові повідомлення — не pull
+    ws->fakeMessage(c->id(), "hello");
+    EXPECT_EQ(c->messages.size(), 2u);
+}
+
+// Виробник в окремому потоці (контур керування), pull — з "AsyncTCP":
+// binaryAll/cleanupClients ніколи не викликаються з чужого потоку
+TEST_F(Telemetry, SendsOnlyFromEventContext) {
+    AsyncWebSocketClient* c = ws->fakeConnect();
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> produced{0};
+
+    std::thread control([&]() {
+        for (int i = 0; i < 5000; i++) {
+            if (TelemetryRecord* r = stream.beginRecord()) {
+                r->timeMs = i;
+                stream.commitRecord();
+                produced++;
+            }
+            if (i % 50 == 0) std::this_thread::yield();
+        }
+        done = true;
+    });
+    while (!done) ws->fakeMessage(c->id(), "p");
+    control.join();
+    ws->fakeMessage(c->id(), "p");
+
+    uint32_t received = 0;
+    for (const auto& m : c->messages) received += countIn(m);
+    EXPECT_EQ(received, produced.load());
+    EXPECT_EQ(ws->foreignCalls(), 0u);
+
+    ws->fakeDisconnect(c->id());
+    EXPECT_EQ(stream.beginRecord(), nullptr);
+}
+
+TEST_F(Telemetry, ConfigSetsDecimation) {
+    AsyncWebServerRequest req("/telemetry/config?decim=7");
+    server.handle(req);
+    EXPECT_EQ(req.code(), 200);
+    EXPECT_NE(req.body().find("\"decim\":7"), std::string::npos) << req.body();
+}
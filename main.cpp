@@ -3,7 +3,7 @@
 #include <MPU6050_tockn.h>
 
 
-#include "ControlPage_WebPage.h"
+#include "ControlPage_WebPageGz.h"
 #include "ControlPage_Routes.h"
 #include "NetworkConnection_Manager.h"
 
@@ -11,7 +11,14 @@
 #include "SteperMotor_Controller.h"
 
 #include "BalancePID_Manager.h"
+#include "SteeringPID_Manager.h"
+#include "Telemetry_Stream.h"
+#include "BinaryLog_Sink.h"
+#include "BlackBox_Recorder.h"
+#include "LoopMetrics_Manager.h"
+#include "RobotConfig_Store.h"
 #include "RobotConrtroller_Controller.h"
+#include "DeferredLog_Manager.h"
 
 // =========================================================
 //  ПІНИ
@@ -41,23 +48,40 @@
 //  Об'єкти
 // =========================================================
 
+typedef StepperMotor_Controller<LEFT_STEP_PIN,  LEFT_DIR_PIN,  LEFT_ENABLE_PIN>  LeftMotor;
+typedef StepperMotor_Controller<RIGHT_STEP_PIN, RIGHT_DIR_PIN, RIGHT_ENABLE_PIN> RightMotor;
+
 AsyncWebServer server(80);
 
 MPU6050                    mpu6050(Wire);
-StepperMotor_Controller    leftMotor(LEFT_STEP_PIN,  LEFT_DIR_PIN,  LEFT_ENABLE_PIN,  0);
-StepperMotor_Controller    rightMotor(RIGHT_STEP_PIN, RIGHT_DIR_PIN, RIGHT_ENABLE_PIN, 1);
+LeftMotor                  leftMotor;
+RightMotor                 rightMotor;
 BalanceController          balance;
+SteeringController         steering;
 NetworkConnection_Manager  network(WIFI_STA_SSID, WIFI_STA_PASS, WIFI_AP_SSID, WIFI_AP_PASS);
 ControlPage_Router         router(&server);
+Telemetry_Stream           telemetry(&server);
+BinaryLog_Sink             binLog(&server, Serial);
+BlackBox_Recorder          blackBox(&server);
+LoopMetrics_Manager        metrics(&server);
+RobotConfig_Store          config(&server);
+
+const ControlPage_Asset    controlPage = { controlPageGz, sizeof(controlPageGz), controlPageETag };
 
-RobotController robot(
+RobotController<LeftMotor, RightMotor> robot(
     mpu6050,
     leftMotor,
     rightMotor,
     balance,
+    steering,
     router,
     network,
-    controlPageHTML
+    telemetry,
+    binLog,
+    blackBox,
+    metrics,
+    config,
+    controlPage
 );
 
 
@@ -67,27 +91,23 @@ RobotController robot(
 
 void setup() {
     Serial.begin(115200);
+    Log().begin(Serial);
     
     Wire.begin(SDA_PIN, SCL_PIN);
 
     Serial.println("\n=== BALANCE BOT STARTUP (FIXED) ===");
 
-    // 1. MPU6050
+    // 1. Налаштування з NVS (зміщення гіроскопа, коефіцієнти, межі)
+    config.load();
+
+    // 2. MPU6050
     Serial.println("📡 Ініціалізація MPU6050...");
     mpu6050.begin();
-    mpu6050.setGyroOffsets(1.0f, 0.0f, -1.0f);
-    
-    
-    balance.setInnerPID(600.0f, 5000.0f, 15.0f); 
-    balance.setOuterPID(3.0f);
-    
-    balance.setBalanceOffset(0.0f);
-
-    // 2. WiFi
-    network.setupLocalWiFi();
-    network.printStatus();
+    if (config.get().flags & CONFIG_BOOT_CALIBRATE) {
+        config.calibrateGyro(mpu6050);
+    }
 
-    // 3. Решта
+    // 3. Керування + WiFi (не блокує: AP+STA підключаються у фоні)
     robot.begin();
     
 }
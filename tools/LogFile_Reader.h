@@ -0,0 +1,170 @@
+#pragma once
+// =========================================================
+//  Читання логів у записи BinaryLog_Sample: .bblog (кілька сеансів
+//  у файлі) і старі текстові LOGS (рамки з псевдографікою).
+//  Спільне для botlog і replay
+// =========================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+#include "../BinaryLog_Format.h"
+
+
+namespace LogFile {
+
+    // Число після key у рядку; false — ключа немає або там не число
+    inline bool valueAfter(const std::string& line, const char* key, double& out) {
+        size_t p = line.find(key);
+        if (p == std::string::npos) return false;
+        const char* s = line.c_str() + p + strlen(key);
+        while (*s == ' ') s++;
+        char* end;
+        double v = strtod(s, &end);
+        if (end == s) return false;
+        out = v;
+        return true;
+    }
+
+    inline bool readFile(const char* path, std::vector<uint8_t>& out) {
+        FILE* f = fopen(path, "rb");
+        if (!f) {
+            fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+            return false;
+        }
+        uint8_t buf[65536];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+        fclose(f);
+        return true;
+    }
+
+    // Файл може містити кілька сеансів (кожен зі своїм заголовком) —
+    // декодер перезапускається на кожному "BBLG"
+    inline bool loadBinary(const char* path, std::vector<BinaryLog_Sample>& samples) {
+        std::vector<uint8_t> data;
+        if (!readFile(path, data)) return false;
+
+        size_t off = 0;
+        bool any = false;
+        uint32_t skipped = 0, bad = 0, lost = 0;
+
+        while (off + BinaryLog::HEADER_SIZE <= data.size()) {
+            BinaryLog_Decoder dec;
+            if (!dec.readHeader(&data[off], data.size() - off)) { off++; skipped++; continue; }
+            any = true;
+            off += BinaryLog::HEADER_SIZE;
+
+            while (off < data.size()) {
+                if (data.size() - off >= 4 && memcmp(&data[off], BinaryLog::MAGIC, 4) == 0) break;
+                BinaryLog_Sample s;
+                bool got;
+                size_t used = dec.decode(&data[off], data.size() - off, s, got);
+                if (got) samples.push_back(s);
+                // Файл прочитано повністю — обірваний запис у кінці лише пропускаємо
+                if (used == 0) { off++; skipped++; continue; }
+                off += used;
+            }
+            skipped += dec.skippedBytes;
+            bad     += dec.badRecords;
+            lost    += dec.lostRecords;
+        }
+
+        if (!any) {
+            fprintf(stderr, "%s is not a BBLG log\n", path);
+            return false;
+        }
+        if (skipped) fprintf(stderr, "%s: skipped %u corrupt bytes\n", path, skipped);
+        if (bad)     fprintf(stderr, "%s: %u records failed CRC\n", path, bad);
+        if (lost)    fprintf(stderr, "%s: %u records lost (seq gaps)\n", path, lost);
+        return true;
+    }
+
+    // onFrame(const BinaryLog_Sample&) — на кожну рамку; повертає кількість рамок
+    template <typename OnFrame>
+    size_t parseText(FILE* in, OnFrame onFrame) {
+        static const char* DIR_NAMES[] = {
+            "STOP", "FORWARD", "BACKWARD", "LEFT", "RIGHT",
+            "FORWARD_LEFT", "FORWARD_RIGHT", "BACKWARD_LEFT", "BACKWARD_RIGHT"
+        };
+
+        BinaryLog_Sample s;
+        s.clear();
+        bool inFrame = false;
+        size_t frames = 0;
+
+        auto flush = [&]() {
+            if (!inFrame) return;
+            onFrame(s);
+            frames++;
+            inFrame = false;
+        };
+
+        char raw[1024];
+        while (fgets(raw, sizeof(raw), in)) {
+            std::string line = raw;
+            double v;
+
+            // Рамка починається з "Час:"; поля, перебиті сторонніми рядками,
+            // лишаються з попереднього кадру
+            if (valueAfter(line, "Час:", v)) {
+                flush();
+                s.v[BLOG_TIME_MS] = (int32_t)v;
+                inFrame = true;
+                continue;
+            }
+            if (!inFrame) continue;
+
+            if      (valueAfter(line, "Pitch (нахил):",      v)) s.set(BLOG_PITCH, v);
+            else if (valueAfter(line, "Roll (крен):",        v)) s.set(BLOG_ROLL, v);
+            else if (valueAfter(line, "Швидкість:",          v)) s.v[BLOG_CMD_SPEED] = (int32_t)v;
+            else if (valueAfter(line, "Поворот:",            v)) s.v[BLOG_CMD_STEER] = (int32_t)v;
+            else if (valueAfter(line, "Target Speed:",       v)) s.set(BLOG_TARGET_SPEED, v);
+            else if (valueAfter(line, "Target Angle:",       v)) s.set(BLOG_TARGET_ANGLE, v);
+            else if (valueAfter(line, "Base Speed:",         v)) s.set(BLOG_BASE_SPEED, v);
+            else if (valueAfter(line, "Estimated Speed:",    v)) s.set(BLOG_EST_SPEED, v);
+            else if (valueAfter(line, "Steer Offset:",       v)) s.set(BLOG_STEER_OFFSET, v);
+            else if (valueAfter(line, "Лівий  швидкість:",   v)) s.set(BLOG_LEFT_SPEED, v);
+            else if (valueAfter(line, "Правий швидкість:",   v)) s.set(BLOG_RIGHT_SPEED, v);
+            else if (valueAfter(line, "Лівий  позиція:",     v)) s.v[BLOG_LEFT_POS] = (int32_t)v;
+            else if (valueAfter(line, "Правий позиція:",     v)) s.v[BLOG_RIGHT_POS] = (int32_t)v;
+            else if (line.find("Напрямок:") != std::string::npos) {
+                for (int d = 8; d >= 0; d--) {
+                    // Довші назви першими: "FORWARD_LEFT" містить "FORWARD"
+                    if (line.find(DIR_NAMES[d]) != std::string::npos) { s.v[BLOG_CMD_DIR] = d; break; }
+                }
+            }
+            else if (line.find("Fallen:") != std::string::npos) {
+                bool ok = line.find("ОК") != std::string::npos;
+                s.v[BLOG_FLAGS] = ok ? (s.v[BLOG_FLAGS] & ~TELEM_FALLEN) : (s.v[BLOG_FLAGS] | TELEM_FALLEN);
+            }
+            else if (line.find("└") != std::string::npos) flush();
+        }
+        flush();
+        return frames;
+    }
+
+    // .bblog за магією "BBLG", інакше — текстовий LOGS
+    inline bool load(const char* path, std::vector<BinaryLog_Sample>& samples) {
+        FILE* f = fopen(path, "rb");
+        if (!f) {
+            fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+            return false;
+        }
+        uint8_t magic[4] = { 0 };
+        bool binary = fread(magic, 1, 4, f) == 4 && memcmp(magic, BinaryLog::MAGIC, 4) == 0;
+        if (binary) {
+            fclose(f);
+            return loadBinary(path, samples);
+        }
+        rewind(f);
+        parseText(f, [&](const BinaryLog_Sample& s) { samples.push_back(s); });
+        fclose(f);
+        return true;
+    }
+
+}
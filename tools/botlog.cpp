@@ -0,0 +1,214 @@
+// =========================================================
+//  botlog — розбір бінарних логів контролера (.bblog) на Linux
+//
+//  Збірка:  g++ -std=c++17 -O2 -I.. -o botlog botlog.cpp
+//
+//  botlog decode    <in.bblog> [out.csv]     CSV (stdout за замовчуванням)
+//  botlog columns   <in.bblog> <outdir>      по файлу float64 на колонку + schema.json
+//  botlog stats     <in.bblog> [--max-speed N]
+//  botlog from-text <LOGS> <out.bblog>       конвертер старих текстових логів
+// =========================================================
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "../BinaryLog_Format.h"
+#include "LogFile_Reader.h"
+
+
+static void printValue(FILE* out, const BinaryLog_Sample& s, size_t i) {
+    if (BLOG_FIELDS[i].scale == 1.0f) fprintf(out, "%d", s.v[i]);
+    else                              fprintf(out, "%.2f", s.get((BinaryLog_Field)i));
+}
+
+
+// === decode ===
+static int cmdDecode(int argc, char** argv) {
+    if (argc < 1) return 2;
+    std::vector<BinaryLog_Sample> samples;
+    if (!LogFile::loadBinary(argv[0], samples)) return 1;
+
+    FILE* out = stdout;
+    if (argc > 1 && !(out = fopen(argv[1], "w"))) {
+        fprintf(stderr, "botlog: cannot write %s\n", argv[1]);
+        return 1;
+    }
+
+    for (size_t i = 0; i < BLOG_FIELD_COUNT; i++) fprintf(out, "%s%s", i ? "," : "", BLOG_FIELDS[i].name);
+    fputc('\n', out);
+    for (const auto& s : samples) {
+        for (size_t i = 0; i < BLOG_FIELD_COUNT; i++) {
+            if (i) fputc(',', out);
+            printValue(out, s, i);
+        }
+        fputc('\n', out);
+    }
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "botlog: %zu records\n", samples.size());
+    return 0;
+}
+
+
+// === columns: колонковий формат (float64 LE на колонку) ===
+static int cmdColumns(int argc, char** argv) {
+    if (argc < 2) return 2;
+    std::vector<BinaryLog_Sample> samples;
+    if (!LogFile::loadBinary(argv[0], samples)) return 1;
+
+    std::string dir = argv[1];
+    mkdir(dir.c_str(), 0755);
+
+    std::string schema = "{\"rows\":" + std::to_string(samples.size()) + ",\"columns\":[";
+    for (size_t i = 0; i < BLOG_FIELD_COUNT; i++) {
+        std::string file = std::string(BLOG_FIELDS[i].name) + ".f64";
+        FILE* f = fopen((dir + "/" + file).c_str(), "wb");
+        if (!f) {
+            fprintf(stderr, "botlog: cannot write %s/%s\n", dir.c_str(), file.c_str());
+            return 1;
+        }
+        for (const auto& s : samples) {
+            double v = s.get((BinaryLog_Field)i);
+            fwrite(&v, sizeof(v), 1, f);
+        }
+        fclose(f);
+        schema += std::string(i ? "," : "") + "{\"name\":\"" + BLOG_FIELDS[i].name
+                + "\",\"type\":\"float64\",\"file\":\"" + file + "\"}";
+    }
+    schema += "]}\n";
+
+    FILE* f = fopen((dir + "/schema.json").c_str(), "w");
+    if (!f) return 1;
+    fputs(schema.c_str(), f);
+    fclose(f);
+    fprintf(stderr, "botlog: %zu rows x %d columns -> %s\n", samples.size(), BLOG_FIELD_COUNT, dir.c_str());
+    return 0;
+}
+
+
+// === stats ===
+static int cmdStats(int argc, char** argv) {
+    if (argc < 1) return 2;
+    float maxSpeed = 15000.0f;   // BalanceController::maxSpeed за замовчуванням
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--max-speed") == 0) maxSpeed = atof(argv[++i]);
+    }
+
+    std::vector<BinaryLog_Sample> samples;
+    if (!LogFile::loadBinary(argv[0], samples)) return 1;
+    if (samples.size() < 2) {
+        fprintf(stderr, "botlog: not enough records\n");
+        return 1;
+    }
+
+    double duration = (samples.back().v[BLOG_TIME_MS] - samples.front().v[BLOG_TIME_MS]) / 1000.0;
+
+    double sum = 0, sumSq = 0, maxTilt = 0;
+    for (const auto& s : samples) {
+        double p = s.get(BLOG_PITCH);
+        sum += p;
+        sumSq += p * p;
+        maxTilt = std::fmax(maxTilt, std::fabs(p));
+    }
+    double n = samples.size();
+    double mean = sum / n;
+    double rms = std::sqrt(sumSq / n);
+    double stddev = std::sqrt(std::fmax(0.0, sumSq / n - mean * mean));
+
+    // Частота коливань: перетини середнього з гістерезисом
+    const double HYST = 0.2;
+    int side = 0;
+    int crossings = 0;
+    for (const auto& s : samples) {
+        double d = s.get(BLOG_PITCH) - mean;
+        int now = d > HYST ? 1 : (d < -HYST ? -1 : 0);
+        if (now != 0 && side != 0 && now != side) crossings++;
+        if (now != 0) side = now;
+    }
+    double oscHz = duration > 0 ? crossings / 2.0 / duration : 0;
+
+    // Насичення: |base_speed| на межі або будь-яке колесо на межі
+    double satTime = 0;
+    uint32_t falls = 0, tickMax = 0;
+    double tickSum = 0;
+    for (size_t i = 1; i < samples.size(); i++) {
+        const auto& s = samples[i];
+        double dt = (s.v[BLOG_TIME_MS] - samples[i - 1].v[BLOG_TIME_MS]) / 1000.0;
+        bool sat = std::fabs(s.get(BLOG_BASE_SPEED))  >= 0.99f * maxSpeed
+                || std::fabs(s.get(BLOG_LEFT_SPEED))  >= 0.99f * maxSpeed
+                || std::fabs(s.get(BLOG_RIGHT_SPEED)) >= 0.99f * maxSpeed;
+        if (sat && dt > 0) satTime += dt;
+        if ((s.v[BLOG_FLAGS] & TELEM_FALLEN) && !(samples[i - 1].v[BLOG_FLAGS] & TELEM_FALLEN)) falls++;
+        tickSum += s.v[BLOG_TICK_US];
+        if ((uint32_t)s.v[BLOG_TICK_US] > tickMax) tickMax = s.v[BLOG_TICK_US];
+    }
+
+    printf("records:          %zu\n", samples.size());
+    printf("duration:         %.2f s\n", duration);
+    printf("pitch mean:       %.2f deg\n", mean);
+    printf("rms tilt:         %.2f deg (about mean: %.2f)\n", rms, stddev);
+    printf("max tilt:         %.2f deg\n", maxTilt);
+    printf("oscillation:      %.2f Hz (%d crossings)\n", oscHz, crossings);
+    printf("saturation time:  %.2f s (%.1f%%, |speed| >= %.0f)\n",
+           satTime, duration > 0 ? 100.0 * satTime / duration : 0.0, 0.99 * maxSpeed);
+    printf("falls:            %u\n", falls);
+    printf("tick us:          mean %.0f, max %u\n", tickSum / (n - 1), tickMax);
+    return 0;
+}
+
+
+// === from-text: старий формат LOGS (розбір у LogFile_Reader.h) ===
+static int cmdFromText(int argc, char** argv) {
+    if (argc < 2) return 2;
+    FILE* in = fopen(argv[0], "r");
+    if (!in) {
+        fprintf(stderr, "botlog: cannot open %s\n", argv[0]);
+        return 1;
+    }
+    FILE* out = fopen(argv[1], "wb");
+    if (!out) {
+        fclose(in);
+        fprintf(stderr, "botlog: cannot write %s\n", argv[1]);
+        return 1;
+    }
+
+    uint8_t buf[BinaryLog::MAX_RECORD_SIZE];
+    fwrite(buf, 1, BinaryLog::writeHeader(buf), out);
+
+    BinaryLog_Encoder enc;
+    size_t frames = LogFile::parseText(in, [&](const BinaryLog_Sample& s) {
+        fwrite(buf, 1, enc.encode(s, buf), out);
+    });
+
+    fclose(in);
+    fclose(out);
+    fprintf(stderr, "botlog: %zu frames -> %s\n", frames, argv[1]);
+    return 0;
+}
+
+
+static int usage() {
+    fprintf(stderr,
+        "usage: botlog decode    <in.bblog> [out.csv]\n"
+        "       botlog columns   <in.bblog> <outdir>\n"
+        "       botlog stats     <in.bblog> [--max-speed N]\n"
+        "       botlog from-text <LOGS> <out.bblog>\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) return usage();
+    const char* cmd = argv[1];
+    int rc = 2;
+    if      (strcmp(cmd, "decode")    == 0) rc = cmdDecode(argc - 2, argv + 2);
+    else if (strcmp(cmd, "columns")   == 0) rc = cmdColumns(argc - 2, argv + 2);
+    else if (strcmp(cmd, "stats")     == 0) rc = cmdStats(argc - 2, argv + 2);
+    else if (strcmp(cmd, "from-text") == 0) rc = cmdFromText(argc - 2, argv + 2);
+    return rc == 2 ? usage() : rc;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Мініфікує і стискає gzip сторінку керування з ControlPage_WebPage.h
+у масив байтів ControlPage_WebPageGz.h (віддається з flash як є).
+
+Запуск з кореня проєкту після кожної зміни сторінки:
+    python3 tools/embed_page.py
+Перевірка без запису (ctest control_page_fresh):
+    python3 tools/embed_page.py --check
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SRC  = os.path.join(ROOT, "ControlPage_WebPage.h")
+DST  = os.path.join(ROOT, "ControlPage_WebPageGz.h")
+
+
+def extract_html(text):
+    m = re.search(r'R"rawHTML\((.*)\)rawHTML"', text, re.S)
+    if not m:
+        sys.exit("rawHTML literal not found in " + SRC)
+    return m.group(1)
+
+
+def minify(html):
+    # Безпечна мініфікація: лише коментарі цілими рядками та відступи,
+    # вміст рядків JS/CSS не чіпаємо
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r"/\*.*?\*/", "", html, flags=re.S)
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def main():
+    with open(SRC, encoding="utf-8") as f:
+        raw = extract_html(f.read())
+
+    mini = minify(raw).encode("utf-8")
+    # mtime=0 — однаковий вихід для однакового входу (стабільний ETag)
+    gz = gzip.compress(mini, compresslevel=9, mtime=0)
+    etag = '"' + hashlib.sha1(gz).hexdigest()[:16] + '"'
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// =========================================================")
+    out.append("//  ЗГЕНЕРОВАНО tools/embed_page.py з ControlPage_WebPage.h")
+    out.append("//  Не редагувати вручну")
+    out.append("//  raw: %d B, minified: %d B, gzip: %d B" % (len(raw.encode("utf-8")), len(mini), len(gz)))
+    out.append("// =========================================================")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("static const char controlPageETag[] = %s;" % ('"' + etag.replace('"', '\\"') + '"'))
+    out.append("")
+    out.append("static const uint8_t controlPageGz[] PROGMEM = {")
+    for i in range(0, len(gz), 16):
+        out.append("    " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+
+    text = "\n".join(out)
+    if "--check" in sys.argv[1:]:
+        # Порівнюємо з тим, що записав би генератор (CRLF, як у файлі)
+        with open(DST, "rb") as f:
+            current = f.read()
+        if current != text.replace("\n", "\r\n").encode("utf-8"):
+            sys.exit("%s is stale: run python3 tools/embed_page.py" % os.path.basename(DST))
+        print("%s is up to date, ETag %s" % (os.path.basename(DST), etag))
+        return
+
+    with open(DST, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write(text)
+
+    print("%s: raw %d B -> minified %d B -> gzip %d B, ETag %s"
+          % (os.path.basename(DST), len(raw.encode("utf-8")), len(mini), len(gz), etag))
+
+
+if __name__ == "__main__":
+    main()
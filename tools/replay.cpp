@@ -0,0 +1,190 @@
+// =========================================================
+//  replay — повторне виконання такту керування (ControlCore) на Linux
+//  по записаних входах: .bblog (чорна скринька, /log) або текстовий LOGS
+//
+//  Збірка:  cmake --build build -t replay   (потрібна заміна Arduino з host/shim)
+//
+//  replay [--threads N] [--repeat R] [--min-time S] [--tol X] <log>...
+//
+//  Кожен прогін — свіжий ControlCore з RobotConfig за замовчуванням.
+//  Прогони розподіляються між потоками; результат кожного має збігтися
+//  з першим (детермінованість), інакше код виходу 1.
+//  Звіт: updates/s і розбіжності виходів з тим, що записав контролер.
+//  Час — лише цикл прогонів (без запуску і join потоків); якщо R
+//  прогонів коротші за S секунд (0.5), їх кількість збільшується
+// =========================================================
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "../ControlTick_Core.h"
+#include "LogFile_Reader.h"
+
+
+struct ReplayLog {
+    const char* path;
+    std::vector<BinaryLog_Sample> samples;
+    std::vector<ControlOutputs>   outputs;     // з першого прогону
+    std::atomic<bool>             mismatch{false};
+};
+
+// Поля, які ядро перераховує, і відповідні колонки запису
+struct CompareField {
+    const char*     name;
+    BinaryLog_Field field;
+    float ControlOutputs::* out;
+};
+
+static const CompareField COMPARE[] = {
+    { "target_speed", BLOG_TARGET_SPEED, &ControlOutputs::targetSpeed },
+    { "base_speed",   BLOG_BASE_SPEED,   &ControlOutputs::baseSpeed   },
+    { "steer_offset", BLOG_STEER_OFFSET, &ControlOutputs::steerOffset },
+    { "left_speed",   BLOG_LEFT_SPEED,   &ControlOutputs::leftSpeed   },
+    { "right_speed",  BLOG_RIGHT_SPEED,  &ControlOutputs::rightSpeed  },
+};
+
+static bool sameOutputs(const ControlOutputs& a, const ControlOutputs& b) {
+    for (const auto& f : COMPARE) {
+        if (memcmp(&(a.*f.out), &(b.*f.out), sizeof(float)) != 0) return false;
+    }
+    return a.cmd.direction == b.cmd.direction && a.cmd.speed == b.cmd.speed && a.cmd.steer == b.cmd.steer;
+}
+
+static void runOnce(ReplayLog& log, bool first) {
+    BalanceController  balance;
+    SteeringController steering;
+    ControlCore core(balance, steering);
+    core.applyConfig(RobotConfigFormat::defaults());
+
+    const BinaryLog_Sample& s0 = log.samples.front();
+    core.begin(s0.v[BLOG_LEFT_POS], s0.v[BLOG_RIGHT_POS], (unsigned long)s0.v[BLOG_TIME_MS]);
+
+    for (size_t i = 0; i < log.samples.size(); i++) {
+        ControlOutputs out;
+        core.step(ControlCore::fromSample(log.samples[i]), out);
+        if (first) log.outputs[i] = out;
+        else if (!sameOutputs(out, log.outputs[i])) log.mismatch = true;
+    }
+}
+
+static void report(const ReplayLog& log, float tol) {
+    size_t n = log.samples.size();
+    size_t differing = 0;
+    double maxDiff[sizeof(COMPARE) / sizeof(COMPARE[0])] = { 0 };
+
+    for (size_t i = 0; i < n; i++) {
+        bool any = false;
+        for (size_t f = 0; f < sizeof(COMPARE) / sizeof(COMPARE[0]); f++) {
+            double d = std::fabs(log.outputs[i].*COMPARE[f].out - log.samples[i].get(COMPARE[f].field));
+            if (d > maxDiff[f]) maxDiff[f] = d;
+            if (d > tol) any = true;
+        }
+        if (any) differing++;
+    }
+
+    printf("%s: %zu ticks, %zu differ from the record by more than %g\n", log.path, n, differing, tol);
+    for (size_t f = 0; f < sizeof(COMPARE) / sizeof(COMPARE[0]); f++) {
+        printf("  %-14s max |diff| %.2f\n", COMPARE[f].name, maxDiff[f]);
+    }
+}
+
+static int usage() {
+    fprintf(stderr, "usage: replay [--threads N] [--repeat R] [--min-time S] [--tol X] <log.bblog|LOGS>...\n");
+    return 2;
+}
+
+// runs прогонів кожного логу: (лог, повтор) по черзі між потоками.
+// Повертає секунди від старту, коли всі потоки готові, до кінця
+// останнього прогону
+static double timedRuns(std::vector<ReplayLog>& logs, unsigned threads, size_t runs) {
+    typedef std::chrono::steady_clock Clock;
+    size_t jobs = logs.size() * runs;
+    std::atomic<size_t>   next{0};
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool>     go{false};
+    std::vector<Clock::time_point> finished(threads);
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            ready++;
+            while (!go) std::this_thread::yield();
+            for (size_t j; (j = next++) < jobs; ) runOnce(logs[j % logs.size()], false);
+            finished[t] = Clock::now();
+        });
+    }
+    while (ready < threads) std::this_thread::yield();
+    Clock::time_point start = Clock::now();
+    go = true;
+    for (auto& th : pool) th.join();
+
+    Clock::time_point end = start;
+    for (const auto& f : finished) if (f > end) end = f;
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    unsigned threads = std::thread::hardware_concurrency();
+    int   repeat = 100;
+    float tol    = 1.0f;
+    double minTime = 0.5;
+    std::vector<const char*> paths;
+
+    for (int i = 1; i < argc; i++) {
+        if      (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--repeat")  == 0 && i + 1 < argc) repeat  = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) minTime = atof(argv[++i]);
+        else if (strcmp(argv[i], "--tol")     == 0 && i + 1 < argc) tol     = atof(argv[++i]);
+        else if (argv[i][0] == '-') return usage();
+        else paths.push_back(argv[i]);
+    }
+    if (paths.empty() || repeat < 1) return usage();
+    if (threads < 1) threads = 1;
+
+    std::vector<ReplayLog> logs(paths.size());
+    size_t ticks = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        logs[i].path = paths[i];
+        if (!LogFile::load(paths[i], logs[i].samples)) return 1;
+        if (logs[i].samples.empty()) {
+            fprintf(stderr, "replay: %s has no records\n", paths[i]);
+            return 1;
+        }
+        logs[i].outputs.resize(logs[i].samples.size());
+        ticks += logs[i].samples.size();
+    }
+
+    // Перший прогін кожного логу — еталон для решти
+    for (auto& log : logs) runOnce(log, true);
+
+    // Решта прогонів. Закороткий замір повторюється з більшою кількістю
+    // прогонів — у звіт іде останній
+    size_t runs = (size_t)(repeat - 1);
+    double sec  = runs ? timedRuns(logs, threads, runs) : 0.0;
+    while (runs && sec < minTime) {
+        double scale = sec > 0 ? minTime / sec * 1.2 : 10.0;
+        runs = (size_t)(runs * (scale < 2.0 ? 2.0 : scale));
+        sec  = timedRuns(logs, threads, runs);
+    }
+    size_t updates = ticks * runs;
+
+    int rc = 0;
+    for (const auto& log : logs) {
+        report(log, tol);
+        if (log.mismatch) {
+            fprintf(stderr, "replay: %s: runs disagree — step() is not deterministic\n", log.path);
+            rc = 1;
+        }
+    }
+    if (updates) {
+        printf("replay: %u threads, %zu updates in %.3f s -> %.0f updates/s\n",
+               threads, updates, sec, sec > 0 ? updates / sec : 0.0);
+    }
+    return rc;
+}